@@ -22,10 +22,24 @@ let package = Package(
         .target(
             name: "CXXCFRef"
         ),
+        .executableTarget(
+            name: "CXXCFRefBenchmarks",
+            dependencies: [
+                "CXXCFRef",
+            ]
+        ),
+        .target(
+            name: "CXXCFRefTestSupport",
+            dependencies: [
+                "CXXCFRef",
+            ],
+            path: "Tests/CXXCFRefTestSupport"
+        ),
         .testTarget(
             name: "CXXCFRefTests",
             dependencies: [
                 "CXXCFRef",
+                "CXXCFRefTestSupport",
             ],
             swiftSettings: [
                 .interoperabilityMode(.Cxx),
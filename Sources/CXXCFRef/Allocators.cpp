@@ -0,0 +1,332 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Allocators.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace {
+
+/// The alignment of every allocation, matching the guarantee of `malloc` on Apple platforms.
+constexpr std::size_t alignment = 16;
+
+/// Rounds `size` up to a multiple of `alignment`.
+constexpr std::size_t alignUp(std::size_t size) noexcept { return (size + alignment - 1) & ~(alignment - 1); }
+
+/// The header preceding every allocation.
+struct alignas(alignment) Header {
+    /// The requested size of the allocation.
+    std::size_t size;
+    /// The size class of the allocation, used by the pool allocator.
+    std::size_t sizeClass;
+};
+
+static_assert(sizeof(Header) == alignment);
+
+/// Returns the header of an allocation.
+Header *headerOf(void *_Nonnull ptr) noexcept { return static_cast<Header *>(ptr) - 1; }
+
+/// A reference count shared by the retain and release callbacks of an allocator context.
+template <typename T> struct RefCounted {
+    mutable std::atomic<std::size_t> refs{0};
+
+    static const void *_Nullable retain(const void *_Nullable info) noexcept {
+        static_cast<const T *>(info)->refs.fetch_add(1, std::memory_order_relaxed);
+        return info;
+    }
+
+    static void release(const void *_Nullable info) noexcept {
+        const auto *object = static_cast<const T *>(info);
+        if (object->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete object;
+        }
+    }
+};
+
+/// Creates a CFAllocator for `info`, whose lifetime is managed by the allocator.
+template <typename T> cf::CFAllocator createAllocator(T *_Nonnull info) noexcept {
+    CFAllocatorContext context = {};
+    context.info = info;
+    context.retain = T::retain;
+    context.release = T::release;
+    context.allocate = T::allocate;
+    context.reallocate = T::reallocate;
+    context.deallocate = T::deallocate;
+
+    auto allocator = cf::CFAllocator::adopt(CFAllocatorCreate(kCFAllocatorDefault, &context));
+    if (!allocator) {
+        delete info;
+    }
+    return allocator;
+}
+
+// MARK: Arena
+
+/// A bump allocator over a list of blocks.
+struct Arena final : RefCounted<Arena> {
+    /// A block of memory, immediately followed by its usable bytes.
+    struct alignas(alignment) Block {
+        Block *_Nullable next;
+    };
+
+    explicit Arena(std::size_t blockSize) noexcept : blockSize{alignUp(blockSize)} {}
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() noexcept {
+        while (head != nullptr) {
+            auto *next = head->next;
+            std::free(head);
+            head = next;
+        }
+    }
+
+    /// Allocates a block with `size` usable bytes and links it into the list.
+    ///
+    /// If `current` is true the block becomes the one allocations are bumped from.
+    char *_Nullable addBlock(std::size_t size, bool current) noexcept {
+        auto *block = static_cast<Block *>(std::malloc(sizeof(Block) + size));
+        if (block == nullptr) {
+            return nullptr;
+        }
+        block->next = head;
+        head = block;
+        auto *bytes = reinterpret_cast<char *>(block + 1);
+        if (current) {
+            cursor = bytes;
+            limit = bytes + size;
+        }
+        return bytes;
+    }
+
+    void *_Nullable allocate(std::size_t size) noexcept {
+        const auto required = sizeof(Header) + alignUp(size);
+        char *bytes;
+        if (required <= static_cast<std::size_t>(limit - cursor)) {
+            bytes = cursor;
+            cursor += required;
+        } else if (required > blockSize / 4) {
+            // Large requests get a dedicated block so the current block is not abandoned
+            bytes = addBlock(required, false);
+        } else if ((bytes = addBlock(blockSize, true)) != nullptr) {
+            cursor += required;
+        }
+        if (bytes == nullptr) {
+            return nullptr;
+        }
+        auto *header = reinterpret_cast<Header *>(bytes);
+        header->size = size;
+        return header + 1;
+    }
+
+    void *_Nullable reallocate(void *_Nonnull ptr, std::size_t size) noexcept {
+        auto *header = headerOf(ptr);
+        auto *end = static_cast<char *>(ptr) + alignUp(header->size);
+        // The most recent allocation can grow or shrink in place
+        if (end == cursor && alignUp(size) <= static_cast<std::size_t>(limit - static_cast<char *>(ptr))) {
+            cursor = static_cast<char *>(ptr) + alignUp(size);
+            header->size = size;
+            return ptr;
+        }
+        if (size <= header->size) {
+            header->size = size;
+            return ptr;
+        }
+        auto *result = allocate(size);
+        if (result != nullptr) {
+            std::memcpy(result, ptr, header->size);
+        }
+        return result;
+    }
+
+    static void *_Nullable allocate(CFIndex size, CFOptionFlags /*hint*/, void *_Nullable info) noexcept {
+        return static_cast<Arena *>(info)->allocate(static_cast<std::size_t>(size));
+    }
+
+    static void *_Nullable reallocate(void *_Nonnull ptr, CFIndex size, CFOptionFlags /*hint*/,
+                                      void *_Nullable info) noexcept {
+        return static_cast<Arena *>(info)->reallocate(ptr, static_cast<std::size_t>(size));
+    }
+
+    static void deallocate(void *_Nonnull /*ptr*/, void *_Nullable /*info*/) noexcept {
+        // Memory is reclaimed when the arena is destroyed
+    }
+
+    /// The size of the blocks allocations are bumped from.
+    const std::size_t blockSize;
+    /// The most recently allocated block.
+    Block *_Nullable head{nullptr};
+    /// The next free byte in the current block.
+    char *_Nullable cursor{nullptr};
+    /// The end of the current block.
+    char *_Nullable limit{nullptr};
+};
+
+// MARK: Pool
+
+/// Free lists of power-of-two size classes carved from slabs.
+struct Pool final : RefCounted<Pool> {
+    /// The smallest size class.
+    static constexpr std::size_t minPooledSize = 16;
+    /// The number of size classes.
+    static constexpr std::size_t sizeClassCount = 7;
+    /// The size class of allocations forwarded to `malloc`.
+    static constexpr std::size_t unpooled = sizeClassCount;
+
+    static_assert((minPooledSize << (sizeClassCount - 1)) == cf::PoolAllocator::maxPooledSize);
+
+    /// A freed allocation.
+    struct FreeNode {
+        FreeNode *_Nullable next;
+    };
+
+    /// A slab, immediately followed by its usable bytes.
+    struct alignas(alignment) Slab {
+        Slab *_Nullable next;
+    };
+
+    explicit Pool(std::size_t slabSize) noexcept
+        : slabSize{std::max(alignUp(slabSize), sizeof(Header) + cf::PoolAllocator::maxPooledSize)} {}
+
+    Pool(const Pool &) = delete;
+    Pool &operator=(const Pool &) = delete;
+
+    ~Pool() noexcept {
+        while (slabs != nullptr) {
+            auto *next = slabs->next;
+            std::free(slabs);
+            slabs = next;
+        }
+    }
+
+    /// Returns the size class for a request of `size` bytes.
+    static std::size_t sizeClassFor(std::size_t size) noexcept {
+        if (size > cf::PoolAllocator::maxPooledSize) {
+            return unpooled;
+        }
+        std::size_t sizeClass = 0;
+        while ((minPooledSize << sizeClass) < size) {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    void *_Nullable allocate(std::size_t size) noexcept {
+        const auto sizeClass = sizeClassFor(size);
+        Header *header;
+        if (sizeClass == unpooled) {
+            header = static_cast<Header *>(std::malloc(sizeof(Header) + size));
+        } else {
+            std::lock_guard lock{mutex};
+            header = allocateFromSlab(sizeClass);
+        }
+        if (header == nullptr) {
+            return nullptr;
+        }
+        header->size = size;
+        header->sizeClass = sizeClass;
+        return header + 1;
+    }
+
+    /// Returns a block for `sizeClass` from its free list or the current slab. The mutex must be held.
+    Header *_Nullable allocateFromSlab(std::size_t sizeClass) noexcept {
+        if (auto *node = freeLists[sizeClass]; node != nullptr) {
+            freeLists[sizeClass] = node->next;
+            return reinterpret_cast<Header *>(node);
+        }
+        const auto required = sizeof(Header) + (minPooledSize << sizeClass);
+        if (required > static_cast<std::size_t>(limit - cursor)) {
+            auto *slab = static_cast<Slab *>(std::malloc(sizeof(Slab) + slabSize));
+            if (slab == nullptr) {
+                return nullptr;
+            }
+            slab->next = slabs;
+            slabs = slab;
+            cursor = reinterpret_cast<char *>(slab + 1);
+            limit = cursor + slabSize;
+        }
+        auto *header = reinterpret_cast<Header *>(cursor);
+        cursor += required;
+        return header;
+    }
+
+    void deallocate(void *_Nonnull ptr) noexcept {
+        auto *header = headerOf(ptr);
+        if (header->sizeClass == unpooled) {
+            std::free(header);
+            return;
+        }
+        std::lock_guard lock{mutex};
+        auto *node = reinterpret_cast<FreeNode *>(header);
+        node->next = freeLists[header->sizeClass];
+        freeLists[header->sizeClass] = node;
+    }
+
+    void *_Nullable reallocate(void *_Nonnull ptr, std::size_t size) noexcept {
+        auto *header = headerOf(ptr);
+        if (header->sizeClass != unpooled && sizeClassFor(size) == header->sizeClass) {
+            header->size = size;
+            return ptr;
+        }
+        auto *result = allocate(size);
+        if (result != nullptr) {
+            std::memcpy(result, ptr, std::min(size, header->size));
+            deallocate(ptr);
+        }
+        return result;
+    }
+
+    static void *_Nullable allocate(CFIndex size, CFOptionFlags /*hint*/, void *_Nullable info) noexcept {
+        return static_cast<Pool *>(info)->allocate(static_cast<std::size_t>(size));
+    }
+
+    static void *_Nullable reallocate(void *_Nonnull ptr, CFIndex size, CFOptionFlags /*hint*/,
+                                      void *_Nullable info) noexcept {
+        return static_cast<Pool *>(info)->reallocate(ptr, static_cast<std::size_t>(size));
+    }
+
+    static void deallocate(void *_Nonnull ptr, void *_Nullable info) noexcept {
+        static_cast<Pool *>(info)->deallocate(ptr);
+    }
+
+    /// The size of the slabs free lists are carved from.
+    const std::size_t slabSize;
+    /// Protects the free lists and slabs.
+    std::mutex mutex;
+    /// The free list of each size class.
+    FreeNode *_Nullable freeLists[sizeClassCount]{};
+    /// The most recently allocated slab.
+    Slab *_Nullable slabs{nullptr};
+    /// The next free byte in the current slab.
+    char *_Nullable cursor{nullptr};
+    /// The end of the current slab.
+    char *_Nullable limit{nullptr};
+};
+
+} /* namespace */
+
+cf::CFAllocator cf::ArenaAllocator::create(std::size_t blockSize) noexcept {
+    auto *arena = new (std::nothrow) Arena{blockSize};
+    if (arena == nullptr) {
+        return {};
+    }
+    return createAllocator(arena);
+}
+
+cf::CFAllocator cf::PoolAllocator::create(std::size_t slabSize) noexcept {
+    auto *pool = new (std::nothrow) Pool{slabSize};
+    if (pool == nullptr) {
+        return {};
+    }
+    return createAllocator(pool);
+}
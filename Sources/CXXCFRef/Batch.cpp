@@ -0,0 +1,38 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Batch.hpp"
+
+#include "cf/DeferredRelease.hpp"
+
+namespace {
+
+/// Releases an array element; the array never retains its elements, so it owns the reference each was added with.
+void releaseElement(CFAllocatorRef _Nullable /*allocator*/, const void *_Nonnull value) noexcept { CFRelease(value); }
+
+/// Callbacks for an array that takes over the references of the objects added to it.
+const CFArrayCallBacks adoptingCallBacks{0, nullptr, releaseElement, nullptr, nullptr};
+
+} /* namespace */
+
+cf::detail::ReleaseBatch::ReleaseBatch(ReleaseMode mode) noexcept {
+    if (mode == ReleaseMode::deferred) {
+        array_ = CFArrayCreateMutable(kCFAllocatorDefault, 0, &adoptingCallBacks);
+    }
+}
+
+cf::detail::ReleaseBatch::~ReleaseBatch() noexcept {
+    if (array_ == nullptr) {
+        return;
+    }
+    if (CFArrayGetCount(array_) == 0) {
+        CFRelease(array_);
+        return;
+    }
+    // Releasing the array on the drain thread releases every element there
+    DeferredRelease::shared().release(array_);
+}
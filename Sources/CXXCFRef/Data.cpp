@@ -0,0 +1,57 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Data.hpp"
+
+#include <utility>
+
+namespace {
+
+/// The context of an allocator that owns the storage of a vector.
+///
+/// The allocator's deallocate callback frees the storage when the CFData is deallocated, and its release callback
+/// deletes the context when the allocator itself is deallocated. Splitting the two means the storage is freed even
+/// if CFDataCreateWithBytesNoCopy fails and never calls the deallocate callback.
+struct VectorOwner {
+    std::vector<std::uint8_t> bytes;
+};
+
+void deallocateVector(void *_Nullable /*ptr*/, void *_Nullable info) noexcept {
+    std::vector<std::uint8_t>().swap(static_cast<VectorOwner *>(info)->bytes);
+}
+
+void releaseVectorOwner(const void *_Nullable info) noexcept {
+    delete static_cast<const VectorOwner *>(info);
+}
+
+} /* namespace */
+
+cf::CFData cf::data_from(std::vector<std::uint8_t> &&bytes) {
+    if (bytes.empty()) {
+        bytes.clear();
+        return CFData::adopt(CFDataCreate(kCFAllocatorDefault, nullptr, 0));
+    }
+
+    auto *owner = new VectorOwner{std::move(bytes)};
+    bytes.clear();
+
+    CFAllocatorContext context = {};
+    context.info = owner;
+    context.release = releaseVectorOwner;
+    context.deallocate = deallocateVector;
+
+    // The allocator holds the only reference to `owner` and deletes it when deallocated
+    const auto allocator = CFAllocator::adopt(CFAllocatorCreate(kCFAllocatorDefault, &context));
+    if (!allocator) {
+        bytes = std::move(owner->bytes);
+        delete owner;
+        return {};
+    }
+
+    return CFData::adopt(CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, owner->bytes.data(),
+                                                     static_cast<CFIndex>(owner->bytes.size()), allocator));
+}
@@ -0,0 +1,116 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/DeferredRelease.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <pthread.h>
+
+namespace {
+
+/// Returns the smallest power of two greater than or equal to `value`.
+std::size_t roundUpToPowerOfTwo(std::size_t value) noexcept {
+    std::size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/// The number of objects released per dequeue batch.
+constexpr std::size_t batchSize = 64;
+
+} /* namespace */
+
+struct cf::DeferredRelease::Drainer {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stop{false};
+    std::thread thread;
+};
+
+auto cf::DeferredRelease::shared() -> DeferredRelease & {
+    // Intentionally leaked so objects released during static destruction still have a queue
+    static auto *const queue = new DeferredRelease();
+    return *queue;
+}
+
+cf::DeferredRelease::DeferredRelease(std::size_t capacity, std::chrono::milliseconds interval)
+    : drainer_{std::make_unique<Drainer>()} {
+    capacity = roundUpToPowerOfTwo(capacity);
+    cells_ = std::make_unique<Cell[]>(capacity);
+    mask_ = capacity - 1;
+    for (std::size_t i = 0; i < capacity; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+        cells_[i].object = nullptr;
+    }
+
+    drainer_->thread = std::thread([this, interval] {
+        pthread_setname_np("org.sbooth.CXXCFRef.DeferredRelease");
+        std::unique_lock lock{drainer_->mutex};
+        while (!drainer_->stop) {
+            drainer_->condition.wait_for(lock, interval, [this] { return drainer_->stop; });
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    });
+}
+
+cf::DeferredRelease::~DeferredRelease() noexcept {
+    {
+        std::lock_guard lock{drainer_->mutex};
+        drainer_->stop = true;
+    }
+    drainer_->condition.notify_one();
+    drainer_->thread.join();
+    drain();
+}
+
+std::size_t cf::DeferredRelease::drain() noexcept {
+    std::size_t released = 0;
+    CFTypeRef batch[batchSize];
+    for (;;) {
+        std::size_t count = 0;
+        while (count < batchSize && dequeue(batch[count])) {
+            ++count;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            CFRelease(batch[i]);
+        }
+        released += count;
+        if (count < batchSize) {
+            return released;
+        }
+    }
+}
+
+bool cf::DeferredRelease::dequeue(CFTypeRef _Nullable &object) noexcept {
+    auto position = dequeuePosition_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &cells_[position & mask_];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+        if (difference == 0) {
+            if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = dequeuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+
+    object = cell->object;
+    cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+    return true;
+}
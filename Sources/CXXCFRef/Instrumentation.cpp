@@ -0,0 +1,82 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Instrumentation.hpp"
+
+#if CXXCFREF_INSTRUMENTATION
+
+#include <string_view>
+#include <utility>
+
+namespace {
+
+/// The most recently registered counters.
+std::atomic<cf::instrumentation::detail::Counters *> registry{nullptr};
+
+/// Extracts the type name from a signature produced by `detail::signature`.
+std::string typeNameFrom(std::string_view signature) {
+    // Clang and GCC spell the template argument as "[T = type]" or "[with T = type]"
+    constexpr std::string_view prefix = "T = ";
+    const auto start = signature.find(prefix);
+    if (start == std::string_view::npos) {
+        return std::string(signature);
+    }
+    auto name = signature.substr(start + prefix.size());
+    if (const auto end = name.find_first_of(";]"); end != std::string_view::npos) {
+        name = name.substr(0, end);
+    }
+    return std::string(name);
+}
+
+} /* namespace */
+
+cf::instrumentation::detail::Counters::Counters(const char *_Nonnull signature) noexcept : signature{signature} {
+    auto *head = registry.load(std::memory_order_relaxed);
+    do {
+        next = head;
+    } while (!registry.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+auto cf::instrumentation::snapshot() -> std::vector<TypeStatistics> {
+    std::vector<TypeStatistics> result;
+    for (auto *counters = registry.load(std::memory_order_acquire); counters != nullptr; counters = counters->next) {
+        TypeStatistics statistics;
+        statistics.typeName = typeNameFrom(counters->signature);
+        statistics.adopts = counters->adopts.load(std::memory_order_relaxed);
+        statistics.retains = counters->retains.load(std::memory_order_relaxed);
+        statistics.releases = counters->releases.load(std::memory_order_relaxed);
+        statistics.copies = counters->copies.load(std::memory_order_relaxed);
+        statistics.moves = counters->moves.load(std::memory_order_relaxed);
+        statistics.leaks = counters->leaks.load(std::memory_order_relaxed);
+        statistics.live = static_cast<std::int64_t>(statistics.adopts + statistics.retains) -
+                          static_cast<std::int64_t>(statistics.releases + statistics.leaks);
+        result.push_back(std::move(statistics));
+    }
+    return result;
+}
+
+void cf::instrumentation::reset() noexcept {
+    for (auto *counters = registry.load(std::memory_order_acquire); counters != nullptr; counters = counters->next) {
+        counters->adopts.store(0, std::memory_order_relaxed);
+        counters->retains.store(0, std::memory_order_relaxed);
+        counters->releases.store(0, std::memory_order_relaxed);
+        counters->copies.store(0, std::memory_order_relaxed);
+        counters->moves.store(0, std::memory_order_relaxed);
+        counters->leaks.store(0, std::memory_order_relaxed);
+    }
+}
+
+#if CXXCFREF_INSTRUMENTATION_SIGNPOSTS
+
+os_log_t _Nonnull cf::instrumentation::detail::signpostLog() noexcept {
+    static const os_log_t log = os_log_create("org.sbooth.CXXCFRef", "CFRef");
+    return log;
+}
+
+#endif /* CXXCFREF_INSTRUMENTATION_SIGNPOSTS */
+
+#endif /* CXXCFREF_INSTRUMENTATION */
@@ -0,0 +1,146 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/MappedData.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/// A mapped region of a file.
+///
+/// The allocator's deallocate callback unmaps the region when the CFData is deallocated, and its release callback
+/// deletes the region when the allocator itself is deallocated.
+struct Mapping {
+    void *_Nullable address;
+    std::size_t length;
+};
+
+void unmap(void *_Nullable /*ptr*/, void *_Nullable info) noexcept {
+    auto *mapping = static_cast<Mapping *>(info);
+    if (mapping->address != nullptr) {
+        munmap(mapping->address, mapping->length);
+        mapping->address = nullptr;
+    }
+}
+
+void releaseMapping(const void *_Nullable info) noexcept {
+    auto *mapping = static_cast<Mapping *>(const_cast<void *>(info));
+    unmap(nullptr, mapping);
+    delete mapping;
+}
+
+/// Stores a POSIX-domain error for `code` in `error` if it is not null.
+void setError(CFErrorRef _Nullable *_Nullable error, int code) noexcept {
+    if (error != nullptr) {
+        *error = CFErrorCreate(kCFAllocatorDefault, kCFErrorDomainPOSIX, code, nullptr);
+    }
+}
+
+/// Returns true if `flag` is set in `options`.
+constexpr bool isSet(cf::MapOptions options, cf::MapOptions flag) noexcept {
+    return (options & flag) != cf::MapOptions::none;
+}
+
+} /* namespace */
+
+cf::CFData cf::mapped_data(const char *_Nonnull path, MapOptions options,
+                           CFErrorRef _Nullable *_Nullable error) noexcept {
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        setError(error, errno);
+        return {};
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        const auto code = errno;
+        close(fd);
+        setError(error, code);
+        return {};
+    }
+    if (!S_ISREG(st.st_mode)) {
+        close(fd);
+        setError(error, S_ISDIR(st.st_mode) ? EISDIR : EINVAL);
+        return {};
+    }
+    if (static_cast<unsigned long long>(st.st_size) >
+        static_cast<unsigned long long>(std::numeric_limits<CFIndex>::max())) {
+        close(fd);
+        setError(error, EFBIG);
+        return {};
+    }
+
+    // Zero-length mappings are not permitted
+    if (st.st_size == 0) {
+        close(fd);
+        return CFData::adopt(CFDataCreate(kCFAllocatorDefault, nullptr, 0));
+    }
+
+    const auto length = static_cast<std::size_t>(st.st_size);
+    const int protection = isSet(options, MapOptions::copyOnWrite) ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *address = mmap(nullptr, length, protection, MAP_PRIVATE, fd, 0);
+    const auto code = errno;
+    // The mapping remains valid after the descriptor is closed
+    close(fd);
+    if (address == MAP_FAILED) {
+        setError(error, code);
+        return {};
+    }
+
+    if (isSet(options, MapOptions::sequential)) {
+        madvise(address, length, MADV_SEQUENTIAL);
+    }
+    if (isSet(options, MapOptions::willNeed)) {
+        madvise(address, length, MADV_WILLNEED);
+    }
+
+    auto *mapping = new (std::nothrow) Mapping{address, length};
+    if (mapping == nullptr) {
+        munmap(address, length);
+        setError(error, ENOMEM);
+        return {};
+    }
+
+    CFAllocatorContext context = {};
+    context.info = mapping;
+    context.release = releaseMapping;
+    context.deallocate = unmap;
+
+    // The allocator holds the only reference to `mapping` and unmaps and deletes it when deallocated
+    const auto allocator = CFAllocator::adopt(CFAllocatorCreate(kCFAllocatorDefault, &context));
+    if (!allocator) {
+        releaseMapping(mapping);
+        setError(error, ENOMEM);
+        return {};
+    }
+
+    auto data = CFData::adopt(CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, static_cast<const UInt8 *>(address),
+                                                          static_cast<CFIndex>(length), allocator));
+    if (!data) {
+        setError(error, ENOMEM);
+    }
+    return data;
+}
+
+cf::CFData cf::mapped_data(CFURLRef _Nonnull url, MapOptions options, CFErrorRef _Nullable *_Nullable error) noexcept {
+    char path[PATH_MAX];
+    if (!CFURLGetFileSystemRepresentation(url, true, reinterpret_cast<UInt8 *>(path), sizeof path)) {
+        setError(error, EINVAL);
+        return {};
+    }
+    return mapped_data(path, options, error);
+}
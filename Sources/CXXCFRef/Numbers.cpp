@@ -0,0 +1,92 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Numbers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+namespace {
+
+/// Integers outside the dense range that are cached, in ascending order.
+constexpr std::int64_t sparseValues[] = {
+        8000,  11025,  16000,  22050,  24000,  32000,  44100,  48000,
+        64000, 88200, 96000, 176400, 192000, 352800, 384000,
+};
+
+static_assert(sparseValues[0] > cf::numberCacheMax);
+
+/// The number of integers in the dense range.
+constexpr std::size_t denseCount = static_cast<std::size_t>(cf::numberCacheMax - cf::numberCacheMin + 1);
+
+/// The number of integer CFNumberTypes, from `kCFNumberSInt8Type` to `kCFNumberSInt64Type`.
+constexpr std::size_t typeCount = 4;
+
+/// The cached numbers for each integer CFNumberType: the dense range followed by the sparse values.
+std::atomic<CFNumberRef> slots[typeCount][denseCount + std::size(sparseValues)];
+
+/// Creates a CFNumber of an integer CFNumberType, passing the value with the width that type names.
+CFNumberRef _Nullable createNumber(std::int64_t value, CFNumberType type) noexcept {
+    switch (type) {
+    case kCFNumberSInt8Type: {
+        const auto narrowed = static_cast<std::int8_t>(value);
+        return CFNumberCreate(kCFAllocatorDefault, type, &narrowed);
+    }
+    case kCFNumberSInt16Type: {
+        const auto narrowed = static_cast<std::int16_t>(value);
+        return CFNumberCreate(kCFAllocatorDefault, type, &narrowed);
+    }
+    case kCFNumberSInt32Type: {
+        const auto narrowed = static_cast<std::int32_t>(value);
+        return CFNumberCreate(kCFAllocatorDefault, type, &narrowed);
+    }
+    default:
+        return CFNumberCreate(kCFAllocatorDefault, kCFNumberSInt64Type, &value);
+    }
+}
+
+/// Returns the slot index for a cached value, or -1 if the value is not cached.
+std::ptrdiff_t slotIndex(std::int64_t value) noexcept {
+    if (value >= cf::numberCacheMin && value <= cf::numberCacheMax) {
+        return static_cast<std::ptrdiff_t>(value - cf::numberCacheMin);
+    }
+    const auto *end = std::end(sparseValues);
+    if (const auto *it = std::lower_bound(std::begin(sparseValues), end, value); it != end && *it == value) {
+        return static_cast<std::ptrdiff_t>(denseCount) + (it - std::begin(sparseValues));
+    }
+    return -1;
+}
+
+} /* namespace */
+
+CFNumberRef _Nullable cf::detail::cachedNumber(std::int64_t value, CFNumberType type) noexcept {
+    assert(type >= kCFNumberSInt8Type && type <= kCFNumberSInt64Type);
+    const auto index = slotIndex(value);
+    if (index < 0) {
+        return nullptr;
+    }
+
+    auto &slot = slots[type - kCFNumberSInt8Type][index];
+    if (auto number = slot.load(std::memory_order_acquire); number != nullptr) {
+        return number;
+    }
+
+    // Racing threads may each create a number; the first one stored wins and the others are released
+    auto *number = createNumber(value, type);
+    if (number == nullptr) {
+        return nullptr;
+    }
+    CFNumberRef expected = nullptr;
+    if (!slot.compare_exchange_strong(expected, number, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        CFRelease(number);
+        return expected;
+    }
+    return number;
+}
@@ -0,0 +1,58 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Parallel.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <dispatch/dispatch.h>
+
+namespace {
+
+/// The smallest number of elements processed by a chunk, amortizing the cost of scheduling it.
+constexpr std::size_t minimumChunkSize = 16;
+
+/// The number of chunks scheduled per processor, balancing load when elements take unequal time.
+constexpr std::size_t chunksPerProcessor = 4;
+
+/// The state shared by all chunks of one call.
+struct Chunks {
+    std::size_t count;
+    std::size_t chunkSize;
+    void *_Nullable context;
+    void (*_Nonnull work)(void *_Nullable context, std::size_t begin, std::size_t end);
+};
+
+void applyChunk(void *_Nullable context, std::size_t index) noexcept {
+    const auto &chunks = *static_cast<const Chunks *>(context);
+    const auto begin = index * chunks.chunkSize;
+    const auto end = std::min(begin + chunks.chunkSize, chunks.count);
+    chunks.work(chunks.context, begin, end);
+}
+
+} /* namespace */
+
+void cf::detail::apply_chunks(std::size_t count, void *_Nullable context,
+                              void (*_Nonnull work)(void *_Nullable context, std::size_t begin,
+                                                    std::size_t end)) noexcept {
+    if (count == 0) {
+        return;
+    }
+
+    static const std::size_t processors = std::max(1U, std::thread::hardware_concurrency());
+    const auto target = processors * chunksPerProcessor;
+    const auto chunkSize = std::max(minimumChunkSize, (count + target - 1) / target);
+    const auto chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    Chunks chunks{count, chunkSize, context, work};
+    if (chunkCount == 1) {
+        applyChunk(&chunks, 0);
+        return;
+    }
+    dispatch_apply_f(chunkCount, DISPATCH_APPLY_AUTO, &chunks, applyChunk);
+}
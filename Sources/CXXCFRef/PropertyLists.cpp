@@ -0,0 +1,139 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/PropertyLists.hpp"
+
+#include <cerrno>
+#include <memory>
+#include <new>
+#include <system_error>
+#include <thread>
+
+#include <unistd.h>
+
+#include "cf/MappedData.hpp"
+
+namespace {
+
+/// Stores a POSIX-domain error for `code` in `error` if it is not null.
+void setError(CFErrorRef _Nullable *_Nullable error, int code) noexcept {
+    if (error != nullptr) {
+        *error = CFErrorCreate(kCFAllocatorDefault, kCFErrorDomainPOSIX, code, nullptr);
+    }
+}
+
+/// Writes all of `length` bytes to `fd`, retrying interrupted and partial writes.
+/// @return Zero on success, or the `errno` value on failure.
+int writeAll(int fd, const UInt8 *_Nonnull bytes, CFIndex length) noexcept {
+    while (length > 0) {
+        const auto written = ::write(fd, bytes, static_cast<std::size_t>(length));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        bytes += written;
+        length -= written;
+    }
+    return 0;
+}
+
+} /* namespace */
+
+CFIndex cf::write_property_list(CFPropertyListRef _Nonnull propertyList, CFWriteStreamRef _Nonnull stream,
+                                CFPropertyListFormat format, CFErrorRef _Nullable *_Nullable error) noexcept {
+    return CFPropertyListWrite(propertyList, stream, format, 0, error);
+}
+
+CFIndex cf::write_property_list(CFPropertyListRef _Nonnull propertyList, int fd, CFPropertyListFormat format,
+                                CFIndex chunkSize, CFErrorRef _Nullable *_Nullable error) noexcept {
+    if (chunkSize <= 0) {
+        setError(error, EINVAL);
+        return 0;
+    }
+
+    const std::unique_ptr<UInt8[]> chunk{new (std::nothrow) UInt8[static_cast<std::size_t>(chunkSize)]};
+    if (!chunk) {
+        setError(error, ENOMEM);
+        return 0;
+    }
+
+    CFReadStreamRef readStream = nullptr;
+    CFWriteStreamRef writeStream = nullptr;
+    CFStreamCreateBoundPair(kCFAllocatorDefault, &readStream, &writeStream, chunkSize);
+    const auto input = CFReadStream::adopt(readStream);
+    const auto output = CFWriteStream::adopt(writeStream);
+    if (!input || !output || !CFReadStreamOpen(input) || !CFWriteStreamOpen(output)) {
+        setError(error, ENOMEM);
+        return 0;
+    }
+
+    // The encoder blocks whenever the bound pair's buffer is full, so it needs its own thread
+    CFIndex encoded = 0;
+    CFErrorRef encodeError = nullptr;
+    std::thread encoder;
+    try {
+        encoder = std::thread([&] {
+            encoded = CFPropertyListWrite(propertyList, output, format, 0, &encodeError);
+            CFWriteStreamClose(output);
+        });
+    } catch (const std::system_error &e) {
+        setError(error, e.code().value());
+        return 0;
+    }
+
+    CFIndex total = 0;
+    int writeError = 0;
+    while (writeError == 0) {
+        const auto count = CFReadStreamRead(input, chunk.get(), chunkSize);
+        if (count <= 0) {
+            break;
+        }
+        writeError = writeAll(fd, chunk.get(), count);
+        total += count;
+    }
+
+    // Closing the read end fails any write the encoder is blocked in, so it finishes promptly after an error
+    CFReadStreamClose(input);
+    encoder.join();
+
+    // A write error is reported in preference to the encoder error it causes
+    if (writeError != 0) {
+        if (encodeError != nullptr) {
+            CFRelease(encodeError);
+        }
+        setError(error, writeError);
+        return 0;
+    }
+    if (encoded == 0) {
+        if (error != nullptr) {
+            *error = encodeError;
+        } else if (encodeError != nullptr) {
+            CFRelease(encodeError);
+        }
+        return 0;
+    }
+    return total;
+}
+
+cf::CFPropertyList cf::read_property_list(CFReadStreamRef _Nonnull stream, CFOptionFlags options,
+                                          CFPropertyListFormat *_Nullable format,
+                                          CFErrorRef _Nullable *_Nullable error) noexcept {
+    return CFPropertyList::adopt(
+            CFPropertyListCreateWithStream(kCFAllocatorDefault, stream, 0, options, format, error));
+}
+
+cf::CFPropertyList cf::read_property_list(const char *_Nonnull path, CFOptionFlags options,
+                                          CFPropertyListFormat *_Nullable format,
+                                          CFErrorRef _Nullable *_Nullable error) noexcept {
+    const auto data = mapped_data(path, MapOptions::none, error);
+    if (!data) {
+        return {};
+    }
+    return CFPropertyList::adopt(CFPropertyListCreateWithData(kCFAllocatorDefault, data, options, format, error));
+}
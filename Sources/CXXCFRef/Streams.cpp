@@ -0,0 +1,164 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "cf/Streams.hpp"
+
+#include <cerrno>
+#include <cstddef>
+
+namespace {
+
+using Operation = cf::detail::StreamOperation;
+
+/// The events that can complete a read.
+constexpr CFOptionFlags readEvents =
+        kCFStreamEventHasBytesAvailable | kCFStreamEventErrorOccurred | kCFStreamEventEndEncountered;
+
+/// The events that can complete a write.
+constexpr CFOptionFlags writeEvents =
+        kCFStreamEventCanAcceptBytes | kCFStreamEventErrorOccurred | kCFStreamEventEndEncountered;
+
+/// Returns an error in the POSIX domain.
+cf::CFError posixError(CFIndex code) noexcept {
+    return cf::CFError::adopt(CFErrorCreate(kCFAllocatorDefault, kCFErrorDomainPOSIX, code, nullptr));
+}
+
+/// Sets the result of an operation from a stream's status if the status ends the operation.
+/// @return true if the operation is complete.
+template <typename CopyError, typename Stream>
+bool completeFromStatus(Operation &operation, CFStreamStatus status, CopyError copyError, Stream stream) noexcept {
+    switch (status) {
+    case kCFStreamStatusNotOpen:
+        operation.result.error = posixError(ENOTCONN);
+        return true;
+    case kCFStreamStatusAtEnd:
+    case kCFStreamStatusClosed:
+        // A read reports the end of the stream by transferring no bytes, but a write that can never transfer any fails
+        if (operation.kind == Operation::Kind::write) {
+            operation.result.error = posixError(EPIPE);
+        }
+        return true;
+    case kCFStreamStatusError:
+        operation.result.error = cf::CFError::adopt(copyError(stream));
+        if (!operation.result.error) {
+            operation.result.error = posixError(EIO);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Sets the result of an operation from the return value of CFReadStreamRead or CFWriteStreamWrite.
+template <typename CopyError, typename Stream>
+void completeFromCount(Operation &operation, CFIndex count, CopyError copyError, Stream stream) noexcept {
+    if (count < 0) {
+        operation.result.error = cf::CFError::adopt(copyError(stream));
+        if (!operation.result.error) {
+            operation.result.error = posixError(EIO);
+        }
+        return;
+    }
+    operation.result.bytes = {operation.data, static_cast<std::size_t>(count)};
+}
+
+/// Performs a read if the stream's state allows it to complete without blocking.
+/// @return true if the operation is complete.
+bool tryRead(Operation &operation) noexcept {
+    CFReadStreamRef stream = operation.readStream;
+    if (completeFromStatus(operation, CFReadStreamGetStatus(stream), CFReadStreamCopyError, stream)) {
+        return true;
+    }
+    if (!CFReadStreamHasBytesAvailable(stream)) {
+        return false;
+    }
+
+    if (operation.kind == Operation::Kind::readBuffered) {
+        // The returned bytes are consumed and remain valid until the next operation on the stream
+        CFIndex length = 0;
+        if (const auto *bytes = CFReadStreamGetBuffer(stream, 0, &length); bytes != nullptr && length > 0) {
+            operation.result.bytes = {bytes, static_cast<std::size_t>(length)};
+            return true;
+        }
+    }
+
+    completeFromCount(operation, CFReadStreamRead(stream, operation.data, operation.length), CFReadStreamCopyError,
+                      stream);
+    return true;
+}
+
+/// Performs a write if the stream's state allows it to complete without blocking.
+/// @return true if the operation is complete.
+bool tryWrite(Operation &operation) noexcept {
+    CFWriteStreamRef stream = operation.writeStream;
+    if (completeFromStatus(operation, CFWriteStreamGetStatus(stream), CFWriteStreamCopyError, stream)) {
+        return true;
+    }
+    if (!CFWriteStreamCanAcceptBytes(stream)) {
+        return false;
+    }
+
+    completeFromCount(operation, CFWriteStreamWrite(stream, operation.data, operation.length), CFWriteStreamCopyError,
+                      stream);
+    return true;
+}
+
+void readCallback(CFReadStreamRef _Nonnull stream, CFStreamEventType /*event*/, void *_Nullable info) noexcept {
+    auto &operation = *static_cast<Operation *>(info);
+    if (!tryRead(operation)) {
+        return;
+    }
+    CFReadStreamSetClient(stream, kCFStreamEventNone, nullptr, nullptr);
+    // The operation may be destroyed by its completion
+    operation.resume(operation);
+}
+
+void writeCallback(CFWriteStreamRef _Nonnull stream, CFStreamEventType /*event*/, void *_Nullable info) noexcept {
+    auto &operation = *static_cast<Operation *>(info);
+    if (!tryWrite(operation)) {
+        return;
+    }
+    CFWriteStreamSetClient(stream, kCFStreamEventNone, nullptr, nullptr);
+    // The operation may be destroyed by its completion
+    operation.resume(operation);
+}
+
+} /* namespace */
+
+cf::detail::StreamOperation::StreamOperation(Kind kind, CFReadStreamRef _Nonnull stream,
+                                             span<std::uint8_t> buffer) noexcept
+    : kind{kind}, readStream{CFReadStream::retain(stream)}, data{buffer.data()},
+      length{static_cast<CFIndex>(buffer.size())} {}
+
+cf::detail::StreamOperation::StreamOperation(CFWriteStreamRef _Nonnull stream,
+                                             span<const std::uint8_t> buffer) noexcept
+    : kind{Kind::write}, writeStream{CFWriteStream::retain(stream)}, data{const_cast<std::uint8_t *>(buffer.data())},
+      length{static_cast<CFIndex>(buffer.size())} {}
+
+bool cf::detail::StreamOperation::start() noexcept {
+    CFStreamClientContext context{0, this, nullptr, nullptr, nullptr};
+
+    if (kind == Kind::write) {
+        if (tryWrite(*this)) {
+            return true;
+        }
+        if (!CFWriteStreamSetClient(writeStream, writeEvents, writeCallback, &context)) {
+            result.error = posixError(ENOTSUP);
+            return true;
+        }
+        return false;
+    }
+
+    if (tryRead(*this)) {
+        return true;
+    }
+    if (!CFReadStreamSetClient(readStream, readEvents, readCallback, &context)) {
+        result.error = posixError(ENOTSUP);
+        return true;
+    }
+    return false;
+}
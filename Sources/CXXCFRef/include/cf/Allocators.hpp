@@ -0,0 +1,97 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// Creates CFAllocators backed by a bump arena.
+///
+/// Allocation advances a pointer through large blocks and deallocation does nothing; every block is freed at once
+/// when the allocator is deallocated. Because Core Foundation objects retain their allocator, that happens only after
+/// the last object allocated from the arena has been released. Memory freed by individual objects is not reused, so
+/// an arena suits many short-lived objects that are released together, such as the contents of a parsed property
+/// list.
+///
+/// An arena allocator is not thread-safe: objects may be released on any thread, but allocation from a given arena
+/// must happen on one thread at a time.
+class ArenaAllocator final {
+  public:
+    /// The default size of the blocks the arena allocates from.
+    static constexpr std::size_t defaultBlockSize = 64 * 1024;
+
+    ArenaAllocator() = delete;
+
+    /// Creates an arena allocator.
+    /// @param blockSize The size of the blocks the arena allocates from. Requests larger than a quarter of this
+    /// size receive a dedicated block.
+    /// @return A CFAllocator, or null on failure.
+    [[nodiscard]] static CFAllocator create(std::size_t blockSize = defaultBlockSize) noexcept;
+};
+
+/// Creates CFAllocators backed by free lists of fixed size classes.
+///
+/// Requests of up to `maxPooledSize` bytes are rounded up to a power of two and served from a per-size-class free
+/// list carved out of large slabs; freed blocks return to their list for reuse. Larger requests are forwarded to
+/// `malloc`. All slabs are freed at once when the allocator is deallocated.
+///
+/// A pool allocator is thread-safe.
+class PoolAllocator final {
+  public:
+    /// The largest request served from a free list.
+    static constexpr std::size_t maxPooledSize = 1024;
+
+    /// The default size of the slabs free lists are carved from.
+    static constexpr std::size_t defaultSlabSize = 64 * 1024;
+
+    PoolAllocator() = delete;
+
+    /// Creates a pool allocator.
+    /// @param slabSize The size of the slabs free lists are carved from.
+    /// @return A CFAllocator, or null on failure.
+    [[nodiscard]] static CFAllocator create(std::size_t slabSize = defaultSlabSize) noexcept;
+};
+
+/// Makes an allocator the default allocator of the current thread for the lifetime of the object.
+///
+/// The previous default allocator is restored on destruction. Scopes must be destroyed in reverse order of
+/// construction on the thread that constructed them.
+///
+/// CFAllocatorSetDefault retains an allocator an extra time so that a default allocator is never deallocated. An
+/// arena made the default is therefore never freed; to free an arena in one step pass it explicitly to the
+/// functions that create objects from it instead.
+class ScopedDefaultAllocator final {
+  public:
+    /// Makes `allocator` the default allocator of the current thread.
+    /// @param allocator The allocator to make the default.
+    explicit ScopedDefaultAllocator(CFAllocatorRef _Nonnull allocator) noexcept;
+
+    ScopedDefaultAllocator(const ScopedDefaultAllocator &) = delete;
+    ScopedDefaultAllocator &operator=(const ScopedDefaultAllocator &) = delete;
+
+    /// Restores the previous default allocator.
+    ~ScopedDefaultAllocator() noexcept;
+
+  private:
+    /// The previous default allocator.
+    CFAllocator previous_;
+};
+
+// MARK: - Implementation -
+
+inline ScopedDefaultAllocator::ScopedDefaultAllocator(CFAllocatorRef _Nonnull allocator) noexcept
+    : previous_{CFAllocator::retain(CFAllocatorGetDefault())} {
+    CFAllocatorSetDefault(allocator);
+}
+
+inline ScopedDefaultAllocator::~ScopedDefaultAllocator() noexcept { CFAllocatorSetDefault(previous_); }
+
+} /* namespace cf */
@@ -0,0 +1,317 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+namespace cf {
+
+/// A non-owning, typed, random access view of the elements of a CFArray.
+///
+/// Elements are returned as borrowed `E` values and are never retained. Iteration fetches elements in chunks using
+/// CFArrayGetValues instead of calling CFArrayGetValueAtIndex once per element.
+/// The view does not retain the array, which must outlive the view and must not be mutated while it is in use.
+template <typename E> class ArrayView final {
+  public:
+    static_assert(std::is_pointer_v<E>, "ArrayView only supports Core Foundation opaque objects");
+
+    /// The element type.
+    using value_type = E;
+    /// The type used for sizes.
+    using size_type = std::size_t;
+    /// The type used for distances between iterators.
+    using difference_type = std::ptrdiff_t;
+
+    /// The number of elements fetched by an iterator at a time.
+    static constexpr CFIndex chunkSize = 32;
+
+    class iterator;
+
+    // MARK: Construction
+
+    /// Constructs an empty ArrayView.
+    ArrayView() noexcept = default;
+
+    /// Constructs an ArrayView of a CFArray.
+    /// @param array A CFArray or null.
+    explicit ArrayView(CFArrayRef _Nullable array) noexcept;
+
+    /// Constructs an ArrayView of the managed array of a CFRef.
+    /// @param array A CFRef managing a CFArray or CFMutableArray.
+    template <typename A, typename = std::enable_if_t<std::is_convertible_v<A, CFArrayRef>>>
+    ArrayView(const CFRef<A> &array) noexcept;
+
+    template <typename A, typename = std::enable_if_t<std::is_convertible_v<A, CFArrayRef>>>
+    ArrayView(CFRef<A> &&array) = delete;
+
+    // MARK: Element Access
+
+    /// Returns the number of elements.
+    [[nodiscard]] size_type size() const noexcept;
+
+    /// Returns true if the view contains no elements.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns the element at `index` without retaining it.
+    /// @param index An index less than `size()`.
+    /// @return The element.
+    [[nodiscard, clang::cf_returns_not_retained]] E _Nullable operator[](size_type index) const noexcept;
+
+    /// Returns the first element without retaining it.
+    [[nodiscard, clang::cf_returns_not_retained]] E _Nullable front() const noexcept;
+
+    /// Returns the last element without retaining it.
+    [[nodiscard, clang::cf_returns_not_retained]] E _Nullable back() const noexcept;
+
+    /// Returns the array.
+    [[nodiscard, clang::cf_returns_not_retained]] CFArrayRef _Nullable array() const noexcept;
+
+    // MARK: Iteration
+
+    /// Returns an iterator to the first element.
+    [[nodiscard]] iterator begin() const noexcept;
+
+    /// Returns an iterator past the last element.
+    [[nodiscard]] iterator end() const noexcept;
+
+  private:
+    /// The array.
+    CFArrayRef _Nullable array_{nullptr};
+    /// The number of elements in the array.
+    CFIndex count_{0};
+};
+
+/// A random access iterator over an ArrayView.
+///
+/// Dereferencing yields an `E` by value. Each iterator holds a chunk of prefetched elements, which is copied with the
+/// iterator. Subscripting and the results of postfix increment and decrement read a single element with
+/// CFArrayGetValueAtIndex instead of fetching a chunk.
+template <typename E> class ArrayView<E>::iterator final {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = E;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = E;
+
+    iterator() noexcept = default;
+    iterator(const iterator &other) noexcept;
+    iterator &operator=(const iterator &other) noexcept;
+
+    [[nodiscard]] E _Nullable operator*() const noexcept;
+    [[nodiscard]] E _Nullable operator[](difference_type offset) const noexcept;
+
+    iterator &operator++() noexcept;
+    iterator operator++(int) noexcept;
+    iterator &operator--() noexcept;
+    iterator operator--(int) noexcept;
+    iterator &operator+=(difference_type offset) noexcept;
+    iterator &operator-=(difference_type offset) noexcept;
+
+    [[nodiscard]] friend iterator operator+(iterator it, difference_type offset) noexcept { return it += offset; }
+    [[nodiscard]] friend iterator operator+(difference_type offset, iterator it) noexcept { return it += offset; }
+    [[nodiscard]] friend iterator operator-(iterator it, difference_type offset) noexcept { return it -= offset; }
+    [[nodiscard]] friend difference_type operator-(const iterator &lhs, const iterator &rhs) noexcept {
+        return static_cast<difference_type>(lhs.index_ - rhs.index_);
+    }
+
+    [[nodiscard]] friend bool operator==(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+    [[nodiscard]] friend bool operator!=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ != rhs.index_;
+    }
+    [[nodiscard]] friend bool operator<(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ < rhs.index_;
+    }
+    [[nodiscard]] friend bool operator>(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ > rhs.index_;
+    }
+    [[nodiscard]] friend bool operator<=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ <= rhs.index_;
+    }
+    [[nodiscard]] friend bool operator>=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ >= rhs.index_;
+    }
+
+  private:
+    friend class ArrayView;
+
+    iterator(CFArrayRef _Nullable array, CFIndex count, CFIndex index) noexcept;
+
+    /// Fetches the chunk containing the current index.
+    void fetch() const noexcept;
+
+    /// Returns a copy holding only the current element.
+    iterator single() const noexcept;
+
+    /// Copies the prefetched elements of `other`.
+    void copyChunk(const iterator &other) noexcept;
+
+    /// The array.
+    CFArrayRef _Nullable array_{nullptr};
+    /// The number of elements in the array.
+    CFIndex count_{0};
+    /// The current index.
+    CFIndex index_{0};
+    /// The index of the first prefetched element.
+    mutable CFIndex chunkStart_{0};
+    /// The number of prefetched elements.
+    mutable CFIndex chunkLength_{0};
+    /// The prefetched elements.
+    mutable const void *_Nullable chunk_[chunkSize];
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction
+
+template <typename E>
+inline ArrayView<E>::ArrayView(CFArrayRef _Nullable array) noexcept
+    : array_{array}, count_{array != nullptr ? CFArrayGetCount(array) : 0} {}
+
+template <typename E>
+template <typename A, typename>
+inline ArrayView<E>::ArrayView(const CFRef<A> &array) noexcept : ArrayView(static_cast<CFArrayRef>(array.get())) {}
+
+// MARK: Element Access
+
+template <typename E> inline auto ArrayView<E>::size() const noexcept -> size_type {
+    return static_cast<size_type>(count_);
+}
+
+template <typename E> inline bool ArrayView<E>::empty() const noexcept { return count_ == 0; }
+
+template <typename E> inline E _Nullable ArrayView<E>::operator[](size_type index) const noexcept {
+    assert(index < size());
+    return detail::element_cast<E>(CFArrayGetValueAtIndex(array_, static_cast<CFIndex>(index)));
+}
+
+template <typename E> inline E _Nullable ArrayView<E>::front() const noexcept { return (*this)[0]; }
+
+template <typename E> inline E _Nullable ArrayView<E>::back() const noexcept { return (*this)[size() - 1]; }
+
+template <typename E> inline CFArrayRef _Nullable ArrayView<E>::array() const noexcept { return array_; }
+
+// MARK: Iteration
+
+template <typename E> inline auto ArrayView<E>::begin() const noexcept -> iterator {
+    return iterator(array_, count_, 0);
+}
+
+template <typename E> inline auto ArrayView<E>::end() const noexcept -> iterator {
+    return iterator(array_, count_, count_);
+}
+
+// MARK: Iterator
+
+template <typename E>
+inline ArrayView<E>::iterator::iterator(CFArrayRef _Nullable array, CFIndex count, CFIndex index) noexcept
+    : array_{array}, count_{count}, index_{index} {}
+
+template <typename E>
+inline ArrayView<E>::iterator::iterator(const iterator &other) noexcept
+    : array_{other.array_}, count_{other.count_}, index_{other.index_} {
+    copyChunk(other);
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator=(const iterator &other) noexcept -> iterator & {
+    if (this != &other) {
+        array_ = other.array_;
+        count_ = other.count_;
+        index_ = other.index_;
+        copyChunk(other);
+    }
+    return *this;
+}
+
+template <typename E> inline E _Nullable ArrayView<E>::iterator::operator*() const noexcept {
+    assert(index_ >= 0 && index_ < count_);
+    if (index_ < chunkStart_ || index_ >= chunkStart_ + chunkLength_) {
+        fetch();
+    }
+    return detail::element_cast<E>(chunk_[index_ - chunkStart_]);
+}
+
+template <typename E> inline E _Nullable ArrayView<E>::iterator::operator[](difference_type offset) const noexcept {
+    const auto index = index_ + static_cast<CFIndex>(offset);
+    assert(index >= 0 && index < count_);
+    if (index >= chunkStart_ && index < chunkStart_ + chunkLength_) {
+        return detail::element_cast<E>(chunk_[index - chunkStart_]);
+    }
+    return detail::element_cast<E>(CFArrayGetValueAtIndex(array_, index));
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator++() noexcept -> iterator & {
+    ++index_;
+    return *this;
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator++(int) noexcept -> iterator {
+    auto result = single();
+    ++index_;
+    return result;
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator--() noexcept -> iterator & {
+    --index_;
+    return *this;
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator--(int) noexcept -> iterator {
+    auto result = single();
+    --index_;
+    return result;
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator+=(difference_type offset) noexcept -> iterator & {
+    index_ += static_cast<CFIndex>(offset);
+    return *this;
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::operator-=(difference_type offset) noexcept -> iterator & {
+    index_ -= static_cast<CFIndex>(offset);
+    return *this;
+}
+
+template <typename E> inline void ArrayView<E>::iterator::fetch() const noexcept {
+    // Fetch the chunk ending at the current index when iterating backward
+    const bool backward = chunkLength_ != 0 && index_ < chunkStart_;
+    chunkStart_ = backward ? std::max<CFIndex>(0, index_ - chunkSize + 1) : index_;
+    chunkLength_ = std::min(chunkSize, count_ - chunkStart_);
+    CFArrayGetValues(array_, CFRangeMake(chunkStart_, chunkLength_), chunk_);
+}
+
+template <typename E> inline auto ArrayView<E>::iterator::single() const noexcept -> iterator {
+    iterator result{array_, count_, index_};
+    // A past-the-end or before-the-beginning iterator has no element to read
+    if (index_ >= 0 && index_ < count_) {
+        result.chunkStart_ = index_;
+        result.chunkLength_ = 1;
+        result.chunk_[0] = index_ >= chunkStart_ && index_ < chunkStart_ + chunkLength_
+                                   ? chunk_[index_ - chunkStart_]
+                                   : CFArrayGetValueAtIndex(array_, index_);
+    }
+    return result;
+}
+
+template <typename E> inline void ArrayView<E>::iterator::copyChunk(const iterator &other) noexcept {
+    chunkStart_ = other.chunkStart_;
+    chunkLength_ = other.chunkLength_;
+    std::copy_n(other.chunk_, other.chunkLength_, chunk_);
+}
+
+} /* namespace cf */
@@ -0,0 +1,216 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// A CFRef that may be loaded and replaced concurrently from multiple threads.
+///
+/// Loads are wait-free: a reader announces itself in one of two reader counters, retains the current object, and
+/// withdraws. A writer that replaces an object waits until both counters have been observed at zero before it
+/// releases or returns the previous object, so only loads already in flight can delay it. No lock is taken.
+///
+/// `compare_exchange_strong` and `compare_exchange_weak` compare object identity, not equality.
+template <typename T> class AtomicCFRef final {
+  public:
+    static_assert(std::is_pointer_v<T>, "AtomicCFRef only supports Core Foundation opaque objects");
+
+    /// The type of the values loaded and stored.
+    using value_type = CFRef<T>;
+
+    // MARK: Construction and Destruction
+
+    /// Constructs an AtomicCFRef with a null managed object.
+    AtomicCFRef() noexcept = default;
+
+    /// Constructs an AtomicCFRef with the managed object from a CFRef.
+    /// @param desired A CFRef object.
+    AtomicCFRef(CFRef<T> desired) noexcept;
+
+    AtomicCFRef(const AtomicCFRef &) = delete;
+    AtomicCFRef &operator=(const AtomicCFRef &) = delete;
+
+    /// Replaces the managed object.
+    /// @param desired A CFRef object.
+    /// @return A reference to this.
+    AtomicCFRef &operator=(CFRef<T> desired) noexcept;
+
+    /// Destroys the AtomicCFRef and releases the managed object.
+    ///
+    /// No other thread may access the AtomicCFRef concurrently with its destruction.
+    ~AtomicCFRef() noexcept;
+
+    // MARK: Atomic Operations
+
+    /// Returns a CFRef sharing the managed object.
+    /// @return A CFRef object.
+    [[nodiscard]] CFRef<T> load() const noexcept;
+
+    /// Returns a CFRef sharing the managed object.
+    [[nodiscard]] operator CFRef<T>() const noexcept;
+
+    /// Replaces the managed object.
+    /// @param desired A CFRef object.
+    void store(CFRef<T> desired) noexcept;
+
+    /// Replaces the managed object and returns the previous managed object.
+    /// @param desired A CFRef object.
+    /// @return A CFRef owning the previous managed object.
+    [[nodiscard]] CFRef<T> exchange(CFRef<T> desired) noexcept;
+
+    /// Replaces the managed object if it is identical to the managed object of `expected`.
+    ///
+    /// On failure `expected` is replaced with a CFRef sharing the managed object observed by the exchange.
+    /// @param expected A CFRef object.
+    /// @param desired A CFRef object.
+    /// @return true if the managed object was replaced, false otherwise.
+    bool compare_exchange_strong(CFRef<T> &expected, CFRef<T> desired) noexcept;
+
+    /// Replaces the managed object if it is identical to the managed object of `expected`.
+    ///
+    /// Like `compare_exchange_strong` but may fail spuriously.
+    /// @param expected A CFRef object.
+    /// @param desired A CFRef object.
+    /// @return true if the managed object was replaced, false otherwise.
+    bool compare_exchange_weak(CFRef<T> &expected, CFRef<T> desired) noexcept;
+
+  private:
+    /// Replaces the managed object if it is identical to the managed object of `expected`.
+    ///
+    /// On failure `expected` is replaced with a CFRef sharing the object observed by the failed exchange.
+    /// @param weak true to permit spurious failure.
+    bool compareExchange(CFRef<T> &expected, CFRef<T> desired, bool weak) noexcept;
+
+    /// Releases a previous managed object once no reader can still be retaining it.
+    /// @param object A Core Foundation object or null.
+    void retire(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Waits until each reader counter has been observed at zero.
+    void synchronize() noexcept;
+
+    /// The constructive interference size used to keep the counters and the managed object on separate cache lines.
+    static constexpr std::size_t cacheLineSize = 128;
+
+    /// The managed Core Foundation object.
+    alignas(cacheLineSize) std::atomic<T> object_{nullptr};
+    /// The index of the reader counter used by new loads.
+    alignas(cacheLineSize) std::atomic<unsigned> epoch_{0};
+    /// The number of loads in flight for each epoch parity.
+    mutable std::atomic<std::size_t> readers_[2]{};
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+template <typename T> inline AtomicCFRef<T>::AtomicCFRef(CFRef<T> desired) noexcept : object_{desired.leak()} {}
+
+template <typename T> inline auto AtomicCFRef<T>::operator=(CFRef<T> desired) noexcept -> AtomicCFRef & {
+    store(std::move(desired));
+    return *this;
+}
+
+template <typename T> inline AtomicCFRef<T>::~AtomicCFRef() noexcept {
+    if (auto object = object_.load(std::memory_order_relaxed); object != nullptr) {
+        CFRelease(object);
+    }
+}
+
+// MARK: Atomic Operations
+
+template <typename T> inline CFRef<T> AtomicCFRef<T>::load() const noexcept {
+    // The epoch only selects a counter; correctness does not depend on which one is used
+    auto &readers = readers_[epoch_.load(std::memory_order_relaxed) & 1];
+    readers.fetch_add(1);
+    auto object = object_.load();
+    if (object != nullptr) {
+        CFRetain(object);
+    }
+    readers.fetch_sub(1);
+    return CFRef<T>::adopt(object);
+}
+
+template <typename T> inline AtomicCFRef<T>::operator CFRef<T>() const noexcept { return load(); }
+
+template <typename T> inline void AtomicCFRef<T>::store(CFRef<T> desired) noexcept {
+    retire(object_.exchange(desired.leak()));
+}
+
+template <typename T> inline CFRef<T> AtomicCFRef<T>::exchange(CFRef<T> desired) noexcept {
+    auto previous = object_.exchange(desired.leak());
+    if (previous != nullptr) {
+        synchronize();
+    }
+    return CFRef<T>::adopt(previous);
+}
+
+template <typename T>
+inline bool AtomicCFRef<T>::compare_exchange_strong(CFRef<T> &expected, CFRef<T> desired) noexcept {
+    return compareExchange(expected, std::move(desired), false);
+}
+
+template <typename T>
+inline bool AtomicCFRef<T>::compare_exchange_weak(CFRef<T> &expected, CFRef<T> desired) noexcept {
+    return compareExchange(expected, std::move(desired), true);
+}
+
+template <typename T>
+inline bool AtomicCFRef<T>::compareExchange(CFRef<T> &expected, CFRef<T> desired, bool weak) noexcept {
+    // The exchange is made as a reader so that on failure the object it observed cannot be released by a concurrent
+    // writer before it is retained
+    auto &readers = readers_[epoch_.load(std::memory_order_relaxed) & 1];
+    readers.fetch_add(1);
+    auto previous = expected.get();
+    const auto exchanged = weak ? object_.compare_exchange_weak(previous, desired.get())
+                                : object_.compare_exchange_strong(previous, desired.get());
+    if (!exchanged && previous != nullptr) {
+        CFRetain(previous);
+    }
+    readers.fetch_sub(1);
+
+    if (exchanged) {
+        static_cast<void>(desired.leak());
+        retire(previous);
+        return true;
+    }
+    expected = CFRef<T>::adopt(previous);
+    return false;
+}
+
+// MARK: Reclamation
+
+template <typename T> inline void AtomicCFRef<T>::retire(T _Nullable object) noexcept {
+    if (object != nullptr) {
+        synchronize();
+        CFRelease(object);
+    }
+}
+
+template <typename T> inline void AtomicCFRef<T>::synchronize() noexcept {
+    // A load that observed the previous object incremented a counter before reading it. Once each counter has been
+    // seen at zero after the exchange, every such load has retained the object. Flipping the epoch before each wait
+    // steers new loads to the other counter so the wait cannot be starved.
+    const auto epoch = epoch_.fetch_add(1);
+    while (readers_[epoch & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+    epoch_.fetch_add(1);
+    while (readers_[(epoch + 1) & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+}
+
+} /* namespace cf */
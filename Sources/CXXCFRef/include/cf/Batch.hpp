@@ -0,0 +1,336 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+#include "Instrumentation.hpp"
+#include "Relocation.hpp"
+#include "SmallBuffer.hpp"
+#include "Span.hpp"
+
+namespace cf {
+
+namespace detail {
+
+/// The element type of a contiguous container such as `std::vector`, `std::array`, or `span`.
+template <typename C> using contiguous_element_t = std::remove_pointer_t<decltype(std::data(std::declval<C &>()))>;
+
+/// Provides the object type `T` of `CFRef<T>` as `type`, and nothing for other types.
+template <typename R> struct ref_object {};
+template <typename T> struct ref_object<CFRef<T>> {
+    using type = T;
+};
+
+} /* namespace detail */
+
+/// Where a batch of objects is released.
+enum class ReleaseMode : unsigned char {
+    /// Each object is released on the calling thread.
+    immediate,
+    /// The objects are collected into a single CFArray that is handed to `DeferredRelease::shared()`, so they are
+    /// released together on its drain thread. The calling thread only appends each object to the array.
+    deferred,
+};
+
+/// Copies CFRefs to uninitialized storage, retaining their objects.
+///
+/// The references are copied with memcpy and then each non-null object is retained in a single pass, instead of
+/// copy-constructing each element. With CXXCFREF_INSTRUMENTATION set the elements are copy-constructed so the
+/// counts remain accurate. The source and destination ranges must not overlap.
+/// @param first The first CFRef to copy.
+/// @param last One past the last CFRef to copy.
+/// @param destination Uninitialized storage for `last - first` CFRefs.
+/// @return One past the last CFRef constructed in the destination.
+template <typename T>
+CFRef<T> *retain_all(const CFRef<T> *first, const CFRef<T> *last, CFRef<T> *destination) noexcept;
+
+/// Copies the CFRefs of a contiguous container such as `std::vector`, `std::array`, or `span` to uninitialized
+/// storage, retaining their objects.
+/// @param refs The CFRefs to copy.
+/// @param destination Uninitialized storage for `std::size(refs)` CFRefs.
+/// @return One past the last CFRef constructed in the destination.
+template <typename Container, typename T,
+          typename = std::enable_if_t<
+                  std::is_same_v<std::remove_const_t<detail::contiguous_element_t<const Container>>, CFRef<T>>>>
+CFRef<T> *retain_all(const Container &refs, CFRef<T> *destination) noexcept;
+
+/// Releases the managed objects of a range of CFRefs and leaves each CFRef null.
+///
+/// The CFRefs remain valid and must still be destroyed, which is then cheap because they are null.
+/// @param first The first CFRef to release.
+/// @param last One past the last CFRef to release.
+/// @param mode Where the objects are released.
+template <typename T>
+void release_all(CFRef<T> *first, CFRef<T> *last, ReleaseMode mode = ReleaseMode::immediate) noexcept;
+
+/// Releases the managed objects of the CFRefs of a contiguous container such as `std::vector`, `std::array`, or
+/// `span` and leaves each CFRef null.
+/// @param refs The CFRefs to release.
+/// @param mode Where the objects are released.
+template <typename Container, typename T = typename detail::ref_object<detail::contiguous_element_t<Container>>::type>
+void release_all(Container &&refs, ReleaseMode mode = ReleaseMode::immediate) noexcept;
+
+/// A sequence of owned Core Foundation objects with inline storage for `N` objects.
+///
+/// The objects are stored as raw pointers, each holding one reference, so `data()` can be passed directly to
+/// functions such as CFArrayCreate. Copies retain every object in one pass over contiguous storage, and
+/// destruction releases every object in one pass, either immediately or through the deferred release queue.
+template <typename T, std::size_t N = 16> class RefBuffer final {
+  public:
+    static_assert(std::is_pointer_v<T>, "RefBuffer only supports Core Foundation opaque objects");
+
+    /// The Core Foundation object type.
+    using element_type = T;
+
+    /// Constructs an empty RefBuffer.
+    /// @param mode Where the objects are released when the buffer is cleared or destroyed.
+    explicit RefBuffer(ReleaseMode mode = ReleaseMode::immediate) noexcept;
+
+    /// Constructs a copy of a RefBuffer with the same release mode, retaining every object.
+    RefBuffer(const RefBuffer &other);
+
+    /// Replaces the contents with a copy of another RefBuffer and adopts its release mode.
+    RefBuffer &operator=(const RefBuffer &other);
+
+    /// Constructs a RefBuffer by moving the contents and release mode of another.
+    RefBuffer(RefBuffer &&other) noexcept;
+
+    /// Replaces the contents with the contents of another RefBuffer and adopts its release mode.
+    RefBuffer &operator=(RefBuffer &&other) noexcept;
+
+    /// Releases every object.
+    ~RefBuffer() noexcept;
+
+    /// Appends an object, retaining it.
+    /// @param ref A CFRef object.
+    void push_back(const CFRef<T> &ref);
+
+    /// Appends an object, taking over the reference held by a CFRef.
+    /// @param ref A CFRef object, which is null afterward.
+    void push_back(CFRef<T> &&ref);
+
+    /// Returns the object at `index` without retaining it.
+    [[nodiscard, clang::cf_returns_not_retained]] T _Nullable operator[](std::size_t index) const noexcept;
+
+    /// Returns the objects.
+    [[nodiscard]] const T _Nullable *_Nonnull data() const noexcept;
+
+    /// Returns the first object.
+    [[nodiscard]] const T _Nullable *_Nonnull begin() const noexcept;
+
+    /// Returns one past the last object.
+    [[nodiscard]] const T _Nullable *_Nonnull end() const noexcept;
+
+    /// Returns the number of objects.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Returns true if there are no objects.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Reserves space for at least `capacity` objects.
+    void reserve(std::size_t capacity);
+
+    /// Releases every object, keeping the storage.
+    void clear() noexcept;
+
+    /// Returns where the objects are released.
+    [[nodiscard]] ReleaseMode releaseMode() const noexcept;
+
+  private:
+    /// The owned objects.
+    detail::SmallBuffer<T, N> objects_;
+    /// Where the objects are released.
+    ReleaseMode mode_;
+};
+
+namespace detail {
+
+/// Collects owned objects and releases them when destroyed.
+///
+/// In immediate mode each object is released as it is added. In deferred mode the objects are appended to a CFArray
+/// whose callbacks release but do not retain, and the array is handed to the shared deferred release queue, so one
+/// queue slot releases the whole batch. If the array cannot be created the objects are released immediately.
+class ReleaseBatch final {
+  public:
+    /// Constructs an empty batch.
+    /// @param mode Where the objects are released.
+    explicit ReleaseBatch(ReleaseMode mode) noexcept;
+
+    ReleaseBatch(const ReleaseBatch &) = delete;
+    ReleaseBatch &operator=(const ReleaseBatch &) = delete;
+
+    /// Enqueues the collected objects for release.
+    ~ReleaseBatch() noexcept;
+
+    /// Adds an owned object to the batch.
+    /// @param object A Core Foundation object or null.
+    void add(CFTypeRef _Nullable object [[clang::cf_consumed]]) noexcept;
+
+  private:
+    /// The collected objects, or null to release each object as it is added.
+    CFMutableArrayRef _Nullable array_{nullptr};
+};
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+inline void detail::ReleaseBatch::add(CFTypeRef _Nullable object) noexcept {
+    if (object == nullptr) {
+        return;
+    }
+    if (array_ != nullptr) {
+        CFArrayAppendValue(array_, object);
+    } else {
+        CFRelease(object);
+    }
+}
+
+template <typename T>
+inline CFRef<T> *retain_all(const CFRef<T> *first, const CFRef<T> *last, CFRef<T> *destination) noexcept {
+    const auto count = static_cast<std::size_t>(last - first);
+#if CXXCFREF_INSTRUMENTATION
+    for (std::size_t i = 0; i < count; ++i) {
+        ::new (static_cast<void *>(destination + i)) CFRef<T>(first[i]);
+    }
+#else
+    static_assert(is_trivially_relocatable_v<CFRef<T>> && sizeof(CFRef<T>) == sizeof(T),
+                  "retain_all requires CFRef to hold only its object pointer");
+    if (count != 0) {
+        std::memcpy(static_cast<void *>(destination), static_cast<const void *>(first), count * sizeof(CFRef<T>));
+    }
+    if constexpr (!is_immortal_type_v<T>) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (const auto object = first[i].get(); object != nullptr) {
+                CFRetain(object);
+            }
+        }
+    }
+#endif /* CXXCFREF_INSTRUMENTATION */
+    return destination + count;
+}
+
+template <typename Container, typename T, typename>
+inline CFRef<T> *retain_all(const Container &refs, CFRef<T> *destination) noexcept {
+    const auto *const first = std::data(refs);
+    return retain_all(first, first + std::size(refs), destination);
+}
+
+template <typename T> inline void release_all(CFRef<T> *first, CFRef<T> *last, ReleaseMode mode) noexcept {
+    if constexpr (is_immortal_type_v<T>) {
+        for (; first != last; ++first) {
+            first->reset();
+        }
+    } else {
+        detail::ReleaseBatch batch{mode};
+        for (; first != last; ++first) {
+            batch.add(first->leak());
+        }
+    }
+}
+
+template <typename Container, typename T> inline void release_all(Container &&refs, ReleaseMode mode) noexcept {
+    auto *const first = std::data(refs);
+    release_all(first, first + std::size(refs), mode);
+}
+
+// MARK: RefBuffer
+
+template <typename T, std::size_t N> inline RefBuffer<T, N>::RefBuffer(ReleaseMode mode) noexcept : mode_{mode} {}
+
+template <typename T, std::size_t N>
+inline RefBuffer<T, N>::RefBuffer(const RefBuffer &other) : mode_{other.mode_} {
+    objects_.append(other.objects_.data(), other.objects_.size());
+    for (std::size_t i = 0; i < objects_.size(); ++i) {
+        static_cast<void>(detail::retain_object(objects_[i]));
+    }
+}
+
+template <typename T, std::size_t N> inline auto RefBuffer<T, N>::operator=(const RefBuffer &other) -> RefBuffer & {
+    if (this != &other) {
+        *this = RefBuffer(other);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+inline RefBuffer<T, N>::RefBuffer(RefBuffer &&other) noexcept
+    : objects_{std::move(other.objects_)}, mode_{other.mode_} {}
+
+template <typename T, std::size_t N> inline auto RefBuffer<T, N>::operator=(RefBuffer &&other) noexcept -> RefBuffer & {
+    if (this != &other) {
+        clear();
+        objects_ = std::move(other.objects_);
+        mode_ = other.mode_;
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N> inline RefBuffer<T, N>::~RefBuffer() noexcept { clear(); }
+
+template <typename T, std::size_t N> inline void RefBuffer<T, N>::push_back(const CFRef<T> &ref) {
+    objects_.push_back(ref.get());
+    static_cast<void>(detail::retain_object(ref.get()));
+}
+
+template <typename T, std::size_t N> inline void RefBuffer<T, N>::push_back(CFRef<T> &&ref) {
+    // The reference is taken only once the object is stored, so it is not lost if storage cannot grow
+    objects_.push_back(ref.get());
+    static_cast<void>(ref.leak());
+}
+
+template <typename T, std::size_t N> inline T _Nullable RefBuffer<T, N>::operator[](std::size_t index) const noexcept {
+    return objects_[index];
+}
+
+template <typename T, std::size_t N> inline const T _Nullable *_Nonnull RefBuffer<T, N>::data() const noexcept {
+    return objects_.data();
+}
+
+template <typename T, std::size_t N> inline const T _Nullable *_Nonnull RefBuffer<T, N>::begin() const noexcept {
+    return objects_.data();
+}
+
+template <typename T, std::size_t N> inline const T _Nullable *_Nonnull RefBuffer<T, N>::end() const noexcept {
+    return objects_.data() + objects_.size();
+}
+
+template <typename T, std::size_t N> inline std::size_t RefBuffer<T, N>::size() const noexcept {
+    return objects_.size();
+}
+
+template <typename T, std::size_t N> inline bool RefBuffer<T, N>::empty() const noexcept { return objects_.empty(); }
+
+template <typename T, std::size_t N> inline void RefBuffer<T, N>::reserve(std::size_t capacity) {
+    objects_.reserve(capacity);
+}
+
+template <typename T, std::size_t N> inline void RefBuffer<T, N>::clear() noexcept {
+    if constexpr (!is_immortal_type_v<T>) {
+        detail::ReleaseBatch batch{mode_};
+        for (std::size_t i = 0; i < objects_.size(); ++i) {
+            batch.add(objects_[i]);
+        }
+    }
+    objects_.clear();
+}
+
+template <typename T, std::size_t N> inline ReleaseMode RefBuffer<T, N>::releaseMode() const noexcept {
+    return mode_;
+}
+
+} /* namespace cf */
@@ -0,0 +1,207 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "SmallBuffer.hpp"
+
+namespace cf {
+
+/// Creates an immutable CFArray containing the elements of a range.
+///
+/// Elements may be Core Foundation objects or CFRefs and must not be null; elements that are temporaries are
+/// retained until the array is created. They are collected into inline storage and the array is created with a
+/// single call to CFArrayCreate using `kCFTypeArrayCallBacks`.
+/// @param range A range of Core Foundation objects.
+/// @return A CFArray, or null on failure.
+template <typename Range> [[nodiscard]] CFArray make_array(const Range &range);
+
+/// Creates an immutable CFArray containing the given elements.
+/// @param elements The Core Foundation objects.
+/// @return A CFArray, or null on failure.
+[[nodiscard]] CFArray make_array(std::initializer_list<CFTypeRef _Nonnull> elements);
+
+/// Creates an immutable CFDictionary containing the key-value pairs of a range.
+///
+/// Elements must be destructurable into a key and a value, such as `std::pair` or the elements of `std::map`. Keys
+/// and values may be Core Foundation objects or CFRefs and must not be null. The range is traversed once, so it may
+/// be a single-pass input range whose elements are temporaries, in which case each key and value is retained until
+/// the dictionary is created. Keys and values are collected into inline storage and the dictionary is created
+/// with a single call to CFDictionaryCreate using `kCFTypeDictionaryKeyCallBacks` and
+/// `kCFTypeDictionaryValueCallBacks`, so it is sized once instead of growing as pairs are inserted. If a key occurs
+/// more than once CFDictionaryCreate keeps the first pair and ignores the rest.
+/// @param range A range of key-value pairs.
+/// @return A CFDictionary, or null on failure.
+template <typename Range> [[nodiscard]] CFDictionary make_dictionary(const Range &range);
+
+/// Creates an immutable CFDictionary containing the given key-value pairs.
+///
+/// If a key occurs more than once the first pair is kept.
+/// @param pairs The key-value pairs.
+/// @return A CFDictionary, or null on failure.
+[[nodiscard]] CFDictionary
+make_dictionary(std::initializer_list<std::pair<CFTypeRef _Nonnull, CFTypeRef _Nonnull>> pairs);
+
+/// Creates an immutable CFSet containing the elements of a range.
+///
+/// Elements may be Core Foundation objects or CFRefs and must not be null; elements that are temporaries are
+/// retained until the set is created. They are collected into inline storage and the set is created with a
+/// single call to CFSetCreate using `kCFTypeSetCallBacks`.
+/// @param range A range of Core Foundation objects.
+/// @return A CFSet, or null on failure.
+template <typename Range> [[nodiscard]] CFSet make_set(const Range &range);
+
+/// Creates an immutable CFSet containing the given elements.
+/// @param elements The Core Foundation objects.
+/// @return A CFSet, or null on failure.
+[[nodiscard]] CFSet make_set(std::initializer_list<CFTypeRef _Nonnull> elements);
+
+namespace detail {
+
+/// The number of elements collected without a heap allocation.
+inline constexpr std::size_t builderInlineCapacity = 32;
+
+/// Detects ranges whose size is known without iterating.
+template <typename Range, typename = void> struct has_size : std::false_type {};
+
+template <typename Range>
+struct has_size<Range, std::void_t<decltype(std::size(std::declval<const Range &>()))>> : std::true_type {};
+
+/// Returns the number of elements in a range, or zero if it is not known without iterating.
+template <typename Range> std::size_t size_hint(const Range &range) noexcept;
+
+/// Detects ranges whose elements are temporaries, such as those of a generator or a transforming view.
+template <typename Range>
+inline constexpr bool has_temporary_elements_v =
+        !std::is_lvalue_reference_v<decltype(*std::begin(std::declval<const Range &>()))>;
+
+/// The objects collected from a range to create a collection.
+///
+/// If `Retain` is true each object is retained as it is collected and released when the Collected is destroyed, so
+/// that it outlives the temporary element it came from.
+template <bool Retain> class Collected final {
+  public:
+    Collected() noexcept = default;
+
+    Collected(const Collected &) = delete;
+    Collected &operator=(const Collected &) = delete;
+
+    ~Collected();
+
+    /// Reserves storage for `capacity` objects.
+    void reserve(std::size_t capacity) { values_.reserve(capacity); }
+
+    /// Appends an object.
+    void push_back(CFTypeRef _Nonnull value);
+
+    /// Returns the objects.
+    [[nodiscard]] const void *_Nonnull *_Nonnull data() noexcept { return values_.data(); }
+
+    /// Returns the number of objects.
+    [[nodiscard]] CFIndex size() const noexcept { return static_cast<CFIndex>(values_.size()); }
+
+  private:
+    /// The objects.
+    SmallBuffer<const void *, builderInlineCapacity> values_;
+};
+
+/// Collects the objects in a range.
+template <typename Range, bool Retain> void collect(const Range &range, Collected<Retain> &values);
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <typename Range> inline std::size_t detail::size_hint(const Range &range) noexcept {
+    if constexpr (has_size<Range>::value) {
+        return static_cast<std::size_t>(std::size(range));
+    } else {
+        return 0;
+    }
+}
+
+template <bool Retain> inline detail::Collected<Retain>::~Collected() {
+    if constexpr (Retain) {
+        for (std::size_t i = 0; i < values_.size(); ++i) {
+            CFRelease(values_[i]);
+        }
+    }
+}
+
+template <bool Retain> inline void detail::Collected<Retain>::push_back(CFTypeRef _Nonnull value) {
+    if constexpr (Retain) {
+        // Grow first so that appending cannot throw and leak the retained object
+        if (values_.size() == values_.capacity()) {
+            values_.reserve(values_.capacity() * 2);
+        }
+        values_.push_back(CFRetain(value));
+    } else {
+        values_.push_back(value);
+    }
+}
+
+template <typename Range, bool Retain>
+inline void detail::collect(const Range &range, Collected<Retain> &values) {
+    values.reserve(size_hint(range));
+    for (const auto &element : range) {
+        const auto value = object(element);
+        assert(value != nullptr && "Core Foundation collections cannot contain null");
+        values.push_back(value);
+    }
+}
+
+template <typename Range> inline CFArray make_array(const Range &range) {
+    detail::Collected<detail::has_temporary_elements_v<Range>> values;
+    detail::collect(range, values);
+    return CFArray::adopt(CFArrayCreate(kCFAllocatorDefault, values.data(), values.size(), &kCFTypeArrayCallBacks));
+}
+
+inline CFArray make_array(std::initializer_list<CFTypeRef _Nonnull> elements) {
+    return make_array<std::initializer_list<CFTypeRef>>(elements);
+}
+
+template <typename Range> inline CFDictionary make_dictionary(const Range &range) {
+    detail::Collected<detail::has_temporary_elements_v<Range>> keys;
+    detail::Collected<detail::has_temporary_elements_v<Range>> values;
+    const auto hint = detail::size_hint(range);
+    keys.reserve(hint);
+    values.reserve(hint);
+    for (const auto &[key, value] : range) {
+        const auto keyObject = detail::object(key);
+        const auto valueObject = detail::object(value);
+        assert(keyObject != nullptr && valueObject != nullptr && "Core Foundation collections cannot contain null");
+        keys.push_back(keyObject);
+        values.push_back(valueObject);
+    }
+    return CFDictionary::adopt(CFDictionaryCreate(kCFAllocatorDefault, keys.data(), values.data(), keys.size(),
+                                                  &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks));
+}
+
+inline CFDictionary make_dictionary(std::initializer_list<std::pair<CFTypeRef _Nonnull, CFTypeRef _Nonnull>> pairs) {
+    return make_dictionary<std::initializer_list<std::pair<CFTypeRef, CFTypeRef>>>(pairs);
+}
+
+template <typename Range> inline CFSet make_set(const Range &range) {
+    detail::Collected<detail::has_temporary_elements_v<Range>> values;
+    detail::collect(range, values);
+    return CFSet::adopt(CFSetCreate(kCFAllocatorDefault, values.data(), values.size(), &kCFTypeSetCallBacks));
+}
+
+inline CFSet make_set(std::initializer_list<CFTypeRef _Nonnull> elements) {
+    return make_set<std::initializer_list<CFTypeRef>>(elements);
+}
+
+} /* namespace cf */
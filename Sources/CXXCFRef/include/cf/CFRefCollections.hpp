@@ -0,0 +1,87 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFArray.h>
+#include <CoreFoundation/CFBag.h>
+#include <CoreFoundation/CFBinaryHeap.h>
+#include <CoreFoundation/CFBitVector.h>
+#include <CoreFoundation/CFDictionary.h>
+#include <CoreFoundation/CFSet.h>
+#include <CoreFoundation/CFTree.h>
+
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+// CFRef aliases and type identifiers for arrays, bags, binary heaps, bit vectors, dictionaries, sets, and trees.
+
+namespace cf {
+
+// MARK: - Type Identifiers
+
+template <> struct type_id_traits<CFArrayRef> {
+    static CFTypeID getTypeID() noexcept { return CFArrayGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableArrayRef> : type_id_traits<CFArrayRef> {};
+template <> struct is_mutable_type<CFMutableArrayRef> : std::true_type {};
+
+template <> struct type_id_traits<CFBagRef> {
+    static CFTypeID getTypeID() noexcept { return CFBagGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableBagRef> : type_id_traits<CFBagRef> {};
+template <> struct is_mutable_type<CFMutableBagRef> : std::true_type {};
+
+template <> struct type_id_traits<CFBinaryHeapRef> {
+    static CFTypeID getTypeID() noexcept { return CFBinaryHeapGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFBitVectorRef> {
+    static CFTypeID getTypeID() noexcept { return CFBitVectorGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableBitVectorRef> : type_id_traits<CFBitVectorRef> {};
+template <> struct is_mutable_type<CFMutableBitVectorRef> : std::true_type {};
+
+template <> struct type_id_traits<CFDictionaryRef> {
+    static CFTypeID getTypeID() noexcept { return CFDictionaryGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableDictionaryRef> : type_id_traits<CFDictionaryRef> {};
+template <> struct is_mutable_type<CFMutableDictionaryRef> : std::true_type {};
+
+template <> struct type_id_traits<CFSetRef> {
+    static CFTypeID getTypeID() noexcept { return CFSetGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableSetRef> : type_id_traits<CFSetRef> {};
+template <> struct is_mutable_type<CFMutableSetRef> : std::true_type {};
+
+template <> struct type_id_traits<CFTreeRef> {
+    static CFTypeID getTypeID() noexcept { return CFTreeGetTypeID(); }
+};
+
+// MARK: - Common Core Foundation Types
+
+using CFArray = CFRef<CFArrayRef>;
+using CFBag = CFRef<CFBagRef>;
+using CFBinaryHeap = CFRef<CFBinaryHeapRef>;
+using CFBitVector = CFRef<CFBitVectorRef>;
+using CFDictionary = CFRef<CFDictionaryRef>;
+using CFMutableArray = CFRef<CFMutableArrayRef>;
+using CFMutableBag = CFRef<CFMutableBagRef>;
+using CFMutableBitVector = CFRef<CFMutableBitVectorRef>;
+using CFMutableDictionary = CFRef<CFMutableDictionaryRef>;
+using CFMutableSet = CFRef<CFMutableSetRef>;
+using CFSet = CFRef<CFSetRef>;
+using CFTree = CFRef<CFTreeRef>;
+
+} /* namespace cf */
@@ -0,0 +1,733 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFBase.h>
+#include <CoreFoundation/CFData.h>
+#include <CoreFoundation/CFNumber.h>
+#include <CoreFoundation/CFString.h>
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefFwd.hpp"
+#include "CFTypeTraits.hpp"
+#include "Instrumentation.hpp"
+#include "Relocation.hpp"
+#include "SwiftInterop.hpp"
+
+namespace cf {
+
+/// Tag indicating that a Core Foundation object is unowned and that the constructor should retain it.
+struct retain_t {
+    explicit retain_t() noexcept = default;
+};
+
+/// The Core Foundation object is unowned and the constructor should retain it.
+inline constexpr retain_t retain{};
+
+namespace detail {
+
+/// Compares Core Foundation objects of type `T`.
+///
+/// The primary template compares objects using CFEqual and provides no ordering. Its `equal` takes the second object
+/// as a CFTypeRef, which also accepts a `T`, so that it remains a single overload when `T` is CFTypeRef.
+/// Specializations for types with a natural ordering reject objects with a different type identifier before calling
+/// a type-specific comparison.
+template <typename T> struct comparator {
+    static constexpr bool is_ordered = false;
+
+    static bool equal(T _Nonnull lhs, CFTypeRef _Nonnull rhs) noexcept {
+        return CFEqual(static_cast<CFTypeRef>(lhs), rhs);
+    }
+};
+
+/// Compares Core Foundation objects of type `T` whose type identifier is known at compile time.
+///
+/// `Derived` provides `equal(T, T)` and `compare(T, T, CFOptionFlags)`.
+template <typename T, typename Derived> struct typed_comparator {
+    static constexpr bool is_ordered = true;
+
+    static bool equal(T _Nonnull lhs, CFTypeRef _Nonnull rhs) noexcept {
+        return CFGetTypeID(rhs) == type_id<T>() && Derived::equal(lhs, static_cast<T>(rhs));
+    }
+};
+
+template <>
+struct comparator<CFStringRef> : typed_comparator<CFStringRef, comparator<CFStringRef>> {
+    using typed_comparator::equal;
+
+    static bool equal(CFStringRef _Nonnull lhs, CFStringRef _Nonnull rhs) noexcept {
+        return CFStringGetLength(lhs) == CFStringGetLength(rhs) && CFStringCompare(lhs, rhs, 0) == kCFCompareEqualTo;
+    }
+
+    static CFComparisonResult compare(CFStringRef _Nonnull lhs, CFStringRef _Nonnull rhs,
+                                      CFOptionFlags options) noexcept {
+        return CFStringCompare(lhs, rhs, static_cast<CFStringCompareFlags>(options));
+    }
+};
+
+template <> struct comparator<CFMutableStringRef> : comparator<CFStringRef> {};
+
+template <>
+struct comparator<CFNumberRef> : typed_comparator<CFNumberRef, comparator<CFNumberRef>> {
+    using typed_comparator::equal;
+
+    static bool equal(CFNumberRef _Nonnull lhs, CFNumberRef _Nonnull rhs) noexcept {
+        return CFNumberCompare(lhs, rhs, nullptr) == kCFCompareEqualTo;
+    }
+
+    static CFComparisonResult compare(CFNumberRef _Nonnull lhs, CFNumberRef _Nonnull rhs,
+                                      CFOptionFlags /*options*/) noexcept {
+        return CFNumberCompare(lhs, rhs, nullptr);
+    }
+};
+
+/// CFData is ordered by length and then lexicographically by bytes.
+template <> struct comparator<CFDataRef> : typed_comparator<CFDataRef, comparator<CFDataRef>> {
+    using typed_comparator::equal;
+
+    static bool equal(CFDataRef _Nonnull lhs, CFDataRef _Nonnull rhs) noexcept {
+        const auto length = CFDataGetLength(lhs);
+        return length == CFDataGetLength(rhs) &&
+               (length == 0 ||
+                std::memcmp(CFDataGetBytePtr(lhs), CFDataGetBytePtr(rhs), static_cast<std::size_t>(length)) == 0);
+    }
+
+    static CFComparisonResult compare(CFDataRef _Nonnull lhs, CFDataRef _Nonnull rhs,
+                                      CFOptionFlags /*options*/) noexcept {
+        const auto lhsLength = CFDataGetLength(lhs);
+        const auto rhsLength = CFDataGetLength(rhs);
+        if (lhsLength != rhsLength) {
+            return lhsLength < rhsLength ? kCFCompareLessThan : kCFCompareGreaterThan;
+        }
+        if (lhsLength == 0) {
+            return kCFCompareEqualTo;
+        }
+        const auto result =
+                std::memcmp(CFDataGetBytePtr(lhs), CFDataGetBytePtr(rhs), static_cast<std::size_t>(lhsLength));
+        return result < 0 ? kCFCompareLessThan : (result > 0 ? kCFCompareGreaterThan : kCFCompareEqualTo);
+    }
+};
+
+template <> struct comparator<CFMutableDataRef> : comparator<CFDataRef> {};
+
+/// Orders two objects of a type with a natural ordering. Null objects order before non-null objects.
+template <typename T>
+inline CFComparisonResult compare_objects(T _Nullable lhs, T _Nullable rhs, CFOptionFlags options) noexcept {
+    if (lhs == rhs) {
+        return kCFCompareEqualTo;
+    }
+    if (lhs == nullptr) {
+        return kCFCompareLessThan;
+    }
+    if (rhs == nullptr) {
+        return kCFCompareGreaterThan;
+    }
+    return comparator<T>::compare(lhs, rhs, options);
+}
+
+/// Retains a Core Foundation object unless it is null or of an immortal type.
+template <typename T> inline T _Nullable retain_object(T _Nullable object) noexcept {
+    if constexpr (is_immortal_type_v<T>) {
+        return object;
+    } else {
+        // CFRetain returns CFTypeRef, which must have its const removed for mutable types
+        return object != nullptr ? static_cast<T>(const_cast<void *>(CFRetain(object))) : nullptr;
+    }
+}
+
+/// Releases a Core Foundation object unless it is null or of an immortal type.
+template <typename T> inline void release_object(T _Nullable object) noexcept {
+    if constexpr (!is_immortal_type_v<T>) {
+        if (object != nullptr) {
+            CXXCFREF_RELEASE(object);
+        }
+    }
+}
+
+} /* namespace detail */
+
+/// An RAII wrapper providing shared ownership semantics for Core Foundation reference-counted types.
+///
+/// For types whose instances are never deallocated, such as CFBoolean and CFNull, CFRetain and CFRelease are
+/// skipped entirely; see `is_immortal_type`.
+template <typename T> class CXXCFREF_TRIVIAL_ABI CFRef final {
+  public:
+    static_assert(std::is_pointer_v<T>, "CFRef only supports Core Foundation opaque objects");
+#if __has_feature(objc_arc)
+    static_assert(!std::is_convertible_v<T, id>, "Use ARC for Objective-C types");
+#endif
+
+    /// The managed Core Foundation object type.
+    using element_type = T;
+
+    // MARK: Factory Methods
+
+    /// Constructs and returns a CFRef for an owned object.
+    ///
+    /// The CFRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    /// @return A CFRef object.
+    static CFRef adopt(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs and returns a CFRef for an unowned object.
+    ///
+    /// The CFRef retains the passed object using CFRetain and assumes responsibility for releasing it using CFRelease.
+    /// @param object A Core Foundation object or null.
+    /// @return A CFRef object.
+    static CFRef retain(T _Nullable object) noexcept;
+
+    // MARK: Construction and Destruction
+
+    /// Constructs an empty CFRef with a null managed object.
+    CFRef() noexcept = default;
+
+    /// Constructs an empty CFRef with a null managed object.
+    CFRef(std::nullptr_t) noexcept;
+
+    /// Constructs a CFRef with an owned object.
+    ///
+    /// The CFRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    explicit CFRef(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs a CFRef with an unowned object.
+    ///
+    /// The CFRef retains the passed object using CFRetain and assumes responsibility for releasing it using CFRelease.
+    /// @param object A Core Foundation object or null.
+    CFRef(T _Nullable object, retain_t /*unused*/) noexcept;
+
+    /// Constructs a copy of an existing CFRef.
+    /// @param other A CFRef object.
+    CFRef(const CFRef &other) noexcept;
+
+    /// Replaces the managed object with the managed object from another CFRef.
+    /// @param other A CFRef object.
+    /// @return A reference to this.
+    CFRef &operator=(const CFRef &other) noexcept;
+
+    /// Constructs a CFRef by moving an existing CFRef.
+    /// @param other A CFRef object.
+    CFRef(CFRef &&other) noexcept;
+
+    /// Replaces the managed object with the managed object from another CFRef.
+    /// @param other A CFRef object.
+    /// @return A reference to this.
+    CFRef &operator=(CFRef &&other) noexcept;
+
+    /// Destroys the CFRef and releases the managed object.
+    ~CFRef() noexcept;
+
+    // MARK: Core Foundation Object Management
+
+    /// Returns true if the managed object is not null.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the managed object.
+    [[nodiscard, clang::cf_returns_not_retained]] operator T() const noexcept;
+
+    /// Returns true if the managed object is equal to the managed object from another CFRef.
+    ///
+    /// Identical and null objects are considered equal; other objects are compared using CFEqual or, for strings,
+    /// numbers, and data, a type-specific comparison.
+    /// @param other A CFRef object.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(const CFRef &other) const noexcept;
+
+    /// Returns true if the managed object is equal to a CFTypeRef.
+    ///
+    /// Identical and null objects are considered equal; other objects are compared using CFEqual or, for strings,
+    /// numbers, and data, a type-specific comparison preceded by a type identifier check.
+    /// @param other A Core Foundation object or null.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(CFTypeRef _Nullable other) const noexcept;
+
+    /// Compares the managed object to the managed object from another CFRef.
+    ///
+    /// Only available for strings, numbers, and data. Null objects order before non-null objects.
+    /// Strings are compared using CFStringCompare, numbers using CFNumberCompare, and data by length and then bytes.
+    /// @param other A CFRef object.
+    /// @param options Comparison flags passed to CFStringCompare; ignored for other types.
+    /// @return The result of the comparison.
+    [[nodiscard]] CFComparisonResult compare(const CFRef &other, CFOptionFlags options = 0) const noexcept;
+
+    /// Returns the managed object.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_not_retained]] T _Nullable get() const & noexcept;
+
+    /// Returns the managed object.
+    ///
+    /// Swift imports this as the computed property `object`, which reads the managed object in place instead of
+    /// copying the wrapper, and receives the bridged object, such as `CFString?`, without a transfer of ownership.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_not_retained]] CXXCFREF_SWIFT_COMPUTED_PROPERTY T _Nullable
+    getObject() const & noexcept;
+
+    /// Resets the managed object and returns a pointer to the internal storage.
+    ///
+    /// The CFRef will assume responsibility for releasing any object written to its storage using CFRelease.
+    /// @return A pointer to a null Core Foundation object.
+    [[nodiscard]] T _Nullable *_Nonnull put() & noexcept;
+
+    /// Replaces the managed object with another owned object.
+    ///
+    /// The CFRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    void reset(T _Nullable object [[clang::cf_consumed]] = nullptr) noexcept;
+
+    /// Swaps the managed object with the managed object from another CFRef.
+    /// @param other A CFRef object.
+    void swap(CFRef &other) noexcept;
+
+    /// Relinquishes ownership of the managed object and returns it.
+    ///
+    /// The caller assumes responsibility for releasing the returned object using CFRelease. Objects of immortal types
+    /// are never retained, so no reference is transferred for them and releasing one is unnecessary.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_retained]] T _Nullable leak() noexcept;
+
+    T _Nullable get() const && = delete;
+    T _Nullable getObject() const && = delete;
+    T _Nullable *_Nonnull put() && = delete;
+
+  private:
+    /// Replaces the managed object with another owned object without recording an adoption.
+    void replace(T _Nullable object) noexcept;
+
+    /// The managed Core Foundation object.
+    T object_{nullptr};
+};
+
+// MARK: - Implementation -
+
+// MARK: Factory Methods
+
+template <typename T> inline auto CFRef<T>::adopt(T _Nullable object) noexcept -> CFRef { return CFRef(object); }
+
+template <typename T> inline auto CFRef<T>::retain(T _Nullable object) noexcept -> CFRef {
+    return CFRef(object, cf::retain);
+}
+
+// MARK: Construction and Destruction
+
+template <typename T> inline CFRef<T>::CFRef(std::nullptr_t) noexcept {}
+
+template <typename T> inline CFRef<T>::CFRef(T _Nullable object) noexcept : object_{object} {
+    if (object_ != nullptr) {
+        CXXCFREF_RECORD(T, adopts);
+    }
+}
+
+template <typename T>
+inline CFRef<T>::CFRef(T _Nullable object, retain_t /*unused*/) noexcept : object_{detail::retain_object(object)} {
+    if (object_ != nullptr) {
+        CXXCFREF_RECORD(T, retains);
+    }
+}
+
+template <typename T> inline CFRef<T>::CFRef(const CFRef &other) noexcept : CFRef(other.object_, cf::retain) {
+    CXXCFREF_RECORD(T, copies);
+}
+
+template <typename T> inline auto CFRef<T>::operator=(const CFRef &other) noexcept -> CFRef & {
+    CXXCFREF_RECORD(T, copies);
+    if (other.object_ != nullptr) {
+        CXXCFREF_RECORD(T, retains);
+    }
+    replace(detail::retain_object(other.object_));
+    return *this;
+}
+
+template <typename T>
+inline CFRef<T>::CFRef(CFRef &&other) noexcept : object_{std::exchange(other.object_, nullptr)} {
+    CXXCFREF_RECORD(T, moves);
+}
+
+template <typename T> inline auto CFRef<T>::operator=(CFRef &&other) noexcept -> CFRef & {
+    CXXCFREF_RECORD(T, moves);
+    replace(std::exchange(other.object_, nullptr));
+    return *this;
+}
+
+template <typename T> inline CFRef<T>::~CFRef() noexcept { replace(nullptr); }
+
+// MARK: Core Foundation Object Management
+
+template <typename T> inline CFRef<T>::operator bool() const noexcept { return object_ != nullptr; }
+
+template <typename T> inline CFRef<T>::operator T() const noexcept { return object_; }
+
+template <typename T> inline bool CFRef<T>::isEqual(const CFRef &other) const noexcept {
+    if (object_ == other.object_) {
+        return true;
+    }
+    return object_ != nullptr && other.object_ != nullptr && detail::comparator<T>::equal(object_, other.object_);
+}
+
+template <typename T> inline bool CFRef<T>::isEqual(CFTypeRef _Nullable other) const noexcept {
+    if (static_cast<CFTypeRef>(object_) == other) {
+        return true;
+    }
+    return object_ != nullptr && other != nullptr && detail::comparator<T>::equal(object_, other);
+}
+
+template <typename T>
+inline CFComparisonResult CFRef<T>::compare(const CFRef &other, CFOptionFlags options) const noexcept {
+    static_assert(detail::comparator<T>::is_ordered, "CFRef::compare requires a string, number, or data type");
+    return detail::compare_objects<T>(object_, other.object_, options);
+}
+
+template <typename T> inline T _Nullable CFRef<T>::get() const & noexcept { return object_; }
+
+template <typename T> inline T _Nullable CFRef<T>::getObject() const & noexcept { return object_; }
+
+template <typename T> inline T _Nullable *_Nonnull CFRef<T>::put() & noexcept {
+    replace(nullptr);
+    CXXCFREF_RECORD(T, adopts);
+    return &object_;
+}
+
+template <typename T> inline void CFRef<T>::reset(T _Nullable object) noexcept {
+    if (object != nullptr) {
+        CXXCFREF_RECORD(T, adopts);
+    }
+    replace(object);
+}
+
+template <typename T> inline void CFRef<T>::swap(CFRef &other) noexcept { std::swap(object_, other.object_); }
+
+template <typename T> inline T _Nullable CFRef<T>::leak() noexcept {
+    if (object_ != nullptr) {
+        CXXCFREF_RECORD(T, leaks);
+    }
+    return std::exchange(object_, nullptr);
+}
+
+template <typename T> inline void CFRef<T>::replace(T _Nullable object) noexcept {
+    if (auto old = std::exchange(object_, object); old != nullptr) {
+        CXXCFREF_RECORD(T, releases);
+        detail::release_object(old);
+    }
+}
+
+/// CFRef holds a single pointer and is trivially relocatable.
+template <typename T> struct is_trivially_relocatable<CFRef<T>> : std::true_type {};
+
+// MARK: - Equality and Hashing
+
+namespace detail {
+
+/// True if `U` is a raw Core Foundation object pointer.
+template <typename U>
+inline constexpr bool is_object_pointer_v = std::is_pointer_v<U> && std::is_convertible_v<U, CFTypeRef>;
+
+/// Returns the Core Foundation object managed by a CFRef.
+template <typename T> inline CFTypeRef _Nullable object(const CFRef<T> &ref) noexcept {
+    return static_cast<CFTypeRef>(ref.get());
+}
+
+/// Returns a raw Core Foundation object.
+inline CFTypeRef _Nullable object(CFTypeRef _Nullable object) noexcept { return object; }
+
+} /* namespace detail */
+
+/// Returns true if the managed objects of two CFRefs are equal.
+///
+/// Null objects are considered equal; non-null objects are compared using CFEqual or, for CFRefs of the same string,
+/// number, or data type, using `CFRef::isEqual` without checking the type of the second object.
+/// @param lhs A CFRef object.
+/// @param rhs A CFRef object.
+/// @return true if the objects are equal, false otherwise.
+template <typename T, typename U> [[nodiscard]] bool operator==(const CFRef<T> &lhs, const CFRef<U> &rhs) noexcept;
+
+/// Returns true if the managed objects of two CFRefs are not equal.
+template <typename T, typename U> [[nodiscard]] bool operator!=(const CFRef<T> &lhs, const CFRef<U> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef is equal to a Core Foundation object.
+///
+/// Null objects are considered equal; non-null objects are compared using CFEqual.
+/// Comparison with a raw pointer compares contents, not identity; compare `get()` to test identity.
+/// @param lhs A CFRef object.
+/// @param rhs A Core Foundation object or null.
+/// @return true if the objects are equal, false otherwise.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_object_pointer_v<U>>>
+[[nodiscard]] bool operator==(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object is equal to the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_object_pointer_v<U>>>
+[[nodiscard]] bool operator==(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef is not equal to a Core Foundation object.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_object_pointer_v<U>>>
+[[nodiscard]] bool operator!=(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object is not equal to the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_object_pointer_v<U>>>
+[[nodiscard]] bool operator!=(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef is null.
+template <typename T> [[nodiscard]] bool operator==(const CFRef<T> &lhs, std::nullptr_t /*unused*/) noexcept;
+
+/// Returns true if the managed object of a CFRef is null.
+template <typename T> [[nodiscard]] bool operator==(std::nullptr_t /*unused*/, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef is not null.
+template <typename T> [[nodiscard]] bool operator!=(const CFRef<T> &lhs, std::nullptr_t /*unused*/) noexcept;
+
+/// Returns true if the managed object of a CFRef is not null.
+template <typename T> [[nodiscard]] bool operator!=(std::nullptr_t /*unused*/, const CFRef<T> &rhs) noexcept;
+
+/// A transparent hash function for CFRefs and raw Core Foundation objects.
+///
+/// Hashes are computed using CFHash; null objects hash to zero. Together with `EqualTo` this allows heterogeneous
+/// lookup of raw objects in containers keyed by CFRef without retaining them.
+struct Hash {
+    using is_transparent = void;
+
+    /// Returns the hash of the managed object of a CFRef.
+    template <typename T> [[nodiscard]] std::size_t operator()(const CFRef<T> &ref) const noexcept;
+
+    /// Returns the hash of a Core Foundation object.
+    [[nodiscard]] std::size_t operator()(CFTypeRef _Nullable object) const noexcept;
+};
+
+/// A transparent equality predicate for CFRefs and raw Core Foundation objects.
+///
+/// Null objects are considered equal; non-null objects are compared using CFEqual.
+struct EqualTo {
+    using is_transparent = void;
+
+    /// Returns true if two objects are equal.
+    /// @param lhs A CFRef object or a Core Foundation object.
+    /// @param rhs A CFRef object or a Core Foundation object.
+    /// @return true if the objects are equal, false otherwise.
+    template <typename L, typename R> [[nodiscard]] bool operator()(const L &lhs, const R &rhs) const noexcept;
+};
+
+// MARK: - Ordering
+
+/// Returns true if the managed object of a CFRef orders before the managed object of another CFRef.
+///
+/// Only available for strings, numbers, and data; objects are ordered using `CFRef::compare` with default options.
+template <typename T, typename = std::enable_if_t<detail::comparator<T>::is_ordered>>
+[[nodiscard]] bool operator<(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef orders after the managed object of another CFRef.
+template <typename T, typename = std::enable_if_t<detail::comparator<T>::is_ordered>>
+[[nodiscard]] bool operator>(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef does not order after the managed object of another CFRef.
+template <typename T, typename = std::enable_if_t<detail::comparator<T>::is_ordered>>
+[[nodiscard]] bool operator<=(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef does not order before the managed object of another CFRef.
+template <typename T, typename = std::enable_if_t<detail::comparator<T>::is_ordered>>
+[[nodiscard]] bool operator>=(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept;
+
+namespace detail {
+
+/// True if a CFRef managing a `T` can be ordered against the raw Core Foundation object `U`.
+template <typename T, typename U>
+inline constexpr bool is_mixed_ordering_v = comparator<T>::is_ordered && is_object_pointer_v<U>;
+
+/// True if CFRefs managing a `T` and a `U` would otherwise be ordered by address.
+template <typename T, typename U>
+inline constexpr bool is_mismatched_ordering_v =
+        !std::is_same_v<T, U> && (comparator<T>::is_ordered || comparator<U>::is_ordered);
+
+} /* namespace detail */
+
+/// Returns true if the managed object of a CFRef orders before a Core Foundation object.
+///
+/// Only available for strings, numbers, and data, and only when the raw object converts to the managed type; objects
+/// are ordered using `CFRef::compare` with default options. Without these overloads the CFRef would convert to its
+/// managed pointer and the objects would be ordered by address.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator<(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object orders before the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator<(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef orders after a Core Foundation object.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator>(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object orders after the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator>(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef does not order after a Core Foundation object.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator<=(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object does not order after the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator<=(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// Returns true if the managed object of a CFRef does not order before a Core Foundation object.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator>=(const CFRef<T> &lhs, U _Nullable rhs) noexcept;
+
+/// Returns true if a Core Foundation object does not order before the managed object of a CFRef.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mixed_ordering_v<T, U>>>
+[[nodiscard]] bool operator>=(U _Nullable lhs, const CFRef<T> &rhs) noexcept;
+
+/// CFRefs of different types are not ordered, because the CFRefs would otherwise convert to their managed pointers and
+/// be ordered by address.
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mismatched_ordering_v<T, U>>>
+bool operator<(const CFRef<T> &lhs, const CFRef<U> &rhs) = delete;
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mismatched_ordering_v<T, U>>>
+bool operator>(const CFRef<T> &lhs, const CFRef<U> &rhs) = delete;
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mismatched_ordering_v<T, U>>>
+bool operator<=(const CFRef<T> &lhs, const CFRef<U> &rhs) = delete;
+template <typename T, typename U, typename = std::enable_if_t<detail::is_mismatched_ordering_v<T, U>>>
+bool operator>=(const CFRef<T> &lhs, const CFRef<U> &rhs) = delete;
+
+// MARK: Implementation
+
+template <typename T, typename U> inline bool operator==(const CFRef<T> &lhs, const CFRef<U> &rhs) noexcept {
+    if constexpr (std::is_same_v<T, U>) {
+        return lhs.isEqual(rhs);
+    } else {
+        return lhs.isEqual(detail::object(rhs));
+    }
+}
+
+template <typename T, typename U> inline bool operator!=(const CFRef<T> &lhs, const CFRef<U> &rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+template <typename T, typename U, typename> inline bool operator==(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return lhs.isEqual(static_cast<CFTypeRef>(rhs));
+}
+
+template <typename T, typename U, typename> inline bool operator==(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return rhs.isEqual(static_cast<CFTypeRef>(lhs));
+}
+
+template <typename T, typename U, typename> inline bool operator!=(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return !lhs.isEqual(static_cast<CFTypeRef>(rhs));
+}
+
+template <typename T, typename U, typename> inline bool operator!=(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return !rhs.isEqual(static_cast<CFTypeRef>(lhs));
+}
+
+template <typename T> inline bool operator==(const CFRef<T> &lhs, std::nullptr_t /*unused*/) noexcept { return !lhs; }
+
+template <typename T> inline bool operator==(std::nullptr_t /*unused*/, const CFRef<T> &rhs) noexcept { return !rhs; }
+
+template <typename T> inline bool operator!=(const CFRef<T> &lhs, std::nullptr_t /*unused*/) noexcept {
+    return static_cast<bool>(lhs);
+}
+
+template <typename T> inline bool operator!=(std::nullptr_t /*unused*/, const CFRef<T> &rhs) noexcept {
+    return static_cast<bool>(rhs);
+}
+
+template <typename T, typename> inline bool operator<(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept {
+    return lhs.compare(rhs) == kCFCompareLessThan;
+}
+
+template <typename T, typename> inline bool operator>(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept {
+    return lhs.compare(rhs) == kCFCompareGreaterThan;
+}
+
+template <typename T, typename> inline bool operator<=(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept {
+    return lhs.compare(rhs) != kCFCompareGreaterThan;
+}
+
+template <typename T, typename> inline bool operator>=(const CFRef<T> &lhs, const CFRef<T> &rhs) noexcept {
+    return lhs.compare(rhs) != kCFCompareLessThan;
+}
+
+namespace detail {
+
+/// Orders the managed object of a CFRef against a Core Foundation object that converts to its type.
+template <typename T, typename U> inline CFComparisonResult compare_mixed(const CFRef<T> &lhs, U rhs) noexcept {
+    static_assert(std::is_convertible_v<U, T>, "A CFRef can only be ordered against an object of its own type");
+    return compare_objects<T>(lhs.get(), static_cast<T>(rhs), 0);
+}
+
+} /* namespace detail */
+
+template <typename T, typename U, typename> inline bool operator<(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return detail::compare_mixed(lhs, rhs) == kCFCompareLessThan;
+}
+
+template <typename T, typename U, typename> inline bool operator<(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return detail::compare_mixed(rhs, lhs) == kCFCompareGreaterThan;
+}
+
+template <typename T, typename U, typename> inline bool operator>(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return detail::compare_mixed(lhs, rhs) == kCFCompareGreaterThan;
+}
+
+template <typename T, typename U, typename> inline bool operator>(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return detail::compare_mixed(rhs, lhs) == kCFCompareLessThan;
+}
+
+template <typename T, typename U, typename> inline bool operator<=(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return detail::compare_mixed(lhs, rhs) != kCFCompareGreaterThan;
+}
+
+template <typename T, typename U, typename> inline bool operator<=(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return detail::compare_mixed(rhs, lhs) != kCFCompareLessThan;
+}
+
+template <typename T, typename U, typename> inline bool operator>=(const CFRef<T> &lhs, U _Nullable rhs) noexcept {
+    return detail::compare_mixed(lhs, rhs) != kCFCompareLessThan;
+}
+
+template <typename T, typename U, typename> inline bool operator>=(U _Nullable lhs, const CFRef<T> &rhs) noexcept {
+    return detail::compare_mixed(rhs, lhs) != kCFCompareGreaterThan;
+}
+
+template <typename T> inline std::size_t Hash::operator()(const CFRef<T> &ref) const noexcept {
+    return (*this)(detail::object(ref));
+}
+
+inline std::size_t Hash::operator()(CFTypeRef _Nullable object) const noexcept {
+    return object != nullptr ? static_cast<std::size_t>(CFHash(object)) : 0;
+}
+
+template <typename L, typename R> inline bool EqualTo::operator()(const L &lhs, const R &rhs) const noexcept {
+    const auto l = detail::object(lhs);
+    const auto r = detail::object(rhs);
+    return (l == nullptr && r == nullptr) || (l != nullptr && r != nullptr && CFEqual(l, r));
+}
+
+// MARK: - Common Core Foundation Types
+
+// The aliases for other types are declared by the family headers, such as CFRefCollections.hpp.
+
+using CFAllocator = CFRef<CFAllocatorRef>;
+using CFBoolean = CFRef<CFBooleanRef>;
+using CFData = CFRef<CFDataRef>;
+using CFMutableData = CFRef<CFMutableDataRef>;
+using CFMutableString = CFRef<CFMutableStringRef>;
+using CFNull = CFRef<CFNullRef>;
+using CFNumber = CFRef<CFNumberRef>;
+using CFPropertyList = CFRef<CFPropertyListRef>;
+using CFString = CFRef<CFStringRef>;
+
+} /* namespace cf */
+
+namespace std {
+
+/// Hashes the managed object of a CFRef using CFHash; null objects hash to zero.
+template <typename T> struct hash<cf::CFRef<T>> {
+    [[nodiscard]] std::size_t operator()(const cf::CFRef<T> &ref) const noexcept { return cf::Hash{}(ref); }
+};
+
+} /* namespace std */
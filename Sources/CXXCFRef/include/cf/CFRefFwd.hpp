@@ -0,0 +1,37 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFBase.h>
+
+// Declarations for headers that only name CFRef types, such as in function signatures or class members held by
+// pointer. Only CFBase.h is included; include CFRefCore.hpp or a family header to use the types.
+
+namespace cf {
+
+/// An RAII wrapper providing shared ownership semantics for Core Foundation reference-counted types.
+///
+/// Defined by CFRefCore.hpp.
+template <typename T> class CFRef;
+
+/// An RAII wrapper providing unique ownership semantics for Core Foundation reference-counted types.
+///
+/// Defined by CFUniqueRef.hpp.
+template <typename T> class CFUniqueRef;
+
+// MARK: - Common Core Foundation Types
+
+// The types declared by CFBase.h. The aliases for other types are declared by CFRefCore.hpp and the family headers.
+
+using CFAllocator = CFRef<CFAllocatorRef>;
+using CFMutableString = CFRef<CFMutableStringRef>;
+using CFNull = CFRef<CFNullRef>;
+using CFPropertyList = CFRef<CFPropertyListRef>;
+using CFString = CFRef<CFStringRef>;
+
+} /* namespace cf */
@@ -0,0 +1,110 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFBundle.h>
+#include <CoreFoundation/CFCalendar.h>
+#include <CoreFoundation/CFDate.h>
+#include <CoreFoundation/CFDateFormatter.h>
+#include <CoreFoundation/CFError.h>
+#include <CoreFoundation/CFFileSecurity.h>
+#include <CoreFoundation/CFLocale.h>
+#include <CoreFoundation/CFNumberFormatter.h>
+#include <CoreFoundation/CFPlugIn.h>
+#include <CoreFoundation/CFTimeZone.h>
+#include <CoreFoundation/CFURL.h>
+#include <CoreFoundation/CFURLEnumerator.h>
+#include <CoreFoundation/CFUUID.h>
+#include <CoreFoundation/CFXMLParser.h>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+// CFRef aliases and type identifiers for bundles, plug-ins, dates, calendars, locales, time zones, formatters,
+// errors, URLs, UUIDs, file security, and the deprecated XML types.
+
+namespace cf {
+
+// MARK: - Type Identifiers
+
+// CFPlugInRef and CFXMLTreeRef are the same types as CFBundleRef and CFTreeRef, so they need no specializations of
+// their own. The deprecated CFXMLNode and CFXMLParser types are omitted.
+
+template <> struct type_id_traits<CFBundleRef> {
+    static CFTypeID getTypeID() noexcept { return CFBundleGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFCalendarRef> {
+    static CFTypeID getTypeID() noexcept { return CFCalendarGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFDateRef> {
+    static CFTypeID getTypeID() noexcept { return CFDateGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFDateFormatterRef> {
+    static CFTypeID getTypeID() noexcept { return CFDateFormatterGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFErrorRef> {
+    static CFTypeID getTypeID() noexcept { return CFErrorGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFFileSecurityRef> {
+    static CFTypeID getTypeID() noexcept { return CFFileSecurityGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFLocaleRef> {
+    static CFTypeID getTypeID() noexcept { return CFLocaleGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFNumberFormatterRef> {
+    static CFTypeID getTypeID() noexcept { return CFNumberFormatterGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFPlugInInstanceRef> {
+    static CFTypeID getTypeID() noexcept { return CFPlugInInstanceGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFTimeZoneRef> {
+    static CFTypeID getTypeID() noexcept { return CFTimeZoneGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFURLRef> {
+    static CFTypeID getTypeID() noexcept { return CFURLGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFURLEnumeratorRef> {
+    static CFTypeID getTypeID() noexcept { return CFURLEnumeratorGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFUUIDRef> {
+    static CFTypeID getTypeID() noexcept { return CFUUIDGetTypeID(); }
+};
+
+// MARK: - Common Core Foundation Types
+
+using CFBundle = CFRef<CFBundleRef>;
+using CFCalendar = CFRef<CFCalendarRef>;
+using CFDate = CFRef<CFDateRef>;
+using CFDateFormatter = CFRef<CFDateFormatterRef>;
+using CFError = CFRef<CFErrorRef>;
+using CFFileSecurity = CFRef<CFFileSecurityRef>;
+using CFLocale = CFRef<CFLocaleRef>;
+using CFNumberFormatter = CFRef<CFNumberFormatterRef>;
+using CFPlugIn = CFRef<CFPlugInRef>;
+using CFPlugInInstance = CFRef<CFPlugInInstanceRef>;
+using CFTimeZone = CFRef<CFTimeZoneRef>;
+using CFURL = CFRef<CFURLRef>;
+using CFURLEnumerator = CFRef<CFURLEnumeratorRef>;
+using CFUUID = CFRef<CFUUIDRef>;
+using CFXMLNode = CFRef<CFXMLNodeRef>;
+using CFXMLParser = CFRef<CFXMLParserRef>;
+using CFXMLTree = CFRef<CFXMLTreeRef>;
+
+} /* namespace cf */
@@ -0,0 +1,83 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFFileDescriptor.h>
+#include <CoreFoundation/CFMachPort.h>
+#include <CoreFoundation/CFMessagePort.h>
+#include <CoreFoundation/CFNotificationCenter.h>
+#include <CoreFoundation/CFRunLoop.h>
+#include <CoreFoundation/CFSocket.h>
+#include <CoreFoundation/CFUserNotification.h>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+// CFRef aliases and type identifiers for run loops and their observers, sources, and timers, and for the ports,
+// sockets, file descriptors, and notifications that are scheduled on them.
+
+namespace cf {
+
+// MARK: - Type Identifiers
+
+template <> struct type_id_traits<CFFileDescriptorRef> {
+    static CFTypeID getTypeID() noexcept { return CFFileDescriptorGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMachPortRef> {
+    static CFTypeID getTypeID() noexcept { return CFMachPortGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMessagePortRef> {
+    static CFTypeID getTypeID() noexcept { return CFMessagePortGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFNotificationCenterRef> {
+    static CFTypeID getTypeID() noexcept { return CFNotificationCenterGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFRunLoopRef> {
+    static CFTypeID getTypeID() noexcept { return CFRunLoopGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFRunLoopObserverRef> {
+    static CFTypeID getTypeID() noexcept { return CFRunLoopObserverGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFRunLoopSourceRef> {
+    static CFTypeID getTypeID() noexcept { return CFRunLoopSourceGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFRunLoopTimerRef> {
+    static CFTypeID getTypeID() noexcept { return CFRunLoopTimerGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFSocketRef> {
+    static CFTypeID getTypeID() noexcept { return CFSocketGetTypeID(); }
+};
+
+#if TARGET_OS_OSX
+template <> struct type_id_traits<CFUserNotificationRef> {
+    static CFTypeID getTypeID() noexcept { return CFUserNotificationGetTypeID(); }
+};
+#endif /* TARGET_OS_OSX */
+
+// MARK: - Common Core Foundation Types
+
+using CFFileDescriptor = CFRef<CFFileDescriptorRef>;
+using CFMachPort = CFRef<CFMachPortRef>;
+using CFMessagePort = CFRef<CFMessagePortRef>;
+using CFNotificationCenter = CFRef<CFNotificationCenterRef>;
+using CFRunLoop = CFRef<CFRunLoopRef>;
+using CFRunLoopObserver = CFRef<CFRunLoopObserverRef>;
+using CFRunLoopSource = CFRef<CFRunLoopSourceRef>;
+using CFRunLoopTimer = CFRef<CFRunLoopTimerRef>;
+using CFSocket = CFRef<CFSocketRef>;
+using CFUserNotification = CFRef<CFUserNotificationRef>;
+
+} /* namespace cf */
@@ -0,0 +1,34 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFStream.h>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+// CFRef aliases and type identifiers for read and write streams.
+
+namespace cf {
+
+// MARK: - Type Identifiers
+
+template <> struct type_id_traits<CFReadStreamRef> {
+    static CFTypeID getTypeID() noexcept { return CFReadStreamGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFWriteStreamRef> {
+    static CFTypeID getTypeID() noexcept { return CFWriteStreamGetTypeID(); }
+};
+
+// MARK: - Common Core Foundation Types
+
+using CFReadStream = CFRef<CFReadStreamRef>;
+using CFWriteStream = CFRef<CFWriteStreamRef>;
+
+} /* namespace cf */
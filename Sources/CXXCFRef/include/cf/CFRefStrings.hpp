@@ -0,0 +1,52 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFAttributedString.h>
+#include <CoreFoundation/CFCharacterSet.h>
+#include <CoreFoundation/CFStringTokenizer.h>
+
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+// CFRef aliases and type identifiers for attributed strings, character sets, and string tokenizers. Strings and
+// data are declared by CFRefCore.hpp.
+
+namespace cf {
+
+// MARK: - Type Identifiers
+
+template <> struct type_id_traits<CFAttributedStringRef> {
+    static CFTypeID getTypeID() noexcept { return CFAttributedStringGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableAttributedStringRef> : type_id_traits<CFAttributedStringRef> {};
+template <> struct is_mutable_type<CFMutableAttributedStringRef> : std::true_type {};
+
+template <> struct type_id_traits<CFCharacterSetRef> {
+    static CFTypeID getTypeID() noexcept { return CFCharacterSetGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableCharacterSetRef> : type_id_traits<CFCharacterSetRef> {};
+template <> struct is_mutable_type<CFMutableCharacterSetRef> : std::true_type {};
+
+template <> struct type_id_traits<CFStringTokenizerRef> {
+    static CFTypeID getTypeID() noexcept { return CFStringTokenizerGetTypeID(); }
+};
+
+// MARK: - Common Core Foundation Types
+
+using CFAttributedString = CFRef<CFAttributedStringRef>;
+using CFCharacterSet = CFRef<CFCharacterSetRef>;
+using CFMutableAttributedString = CFRef<CFMutableAttributedStringRef>;
+using CFMutableCharacterSet = CFRef<CFMutableCharacterSetRef>;
+using CFStringTokenizer = CFRef<CFStringTokenizerRef>;
+
+} /* namespace cf */
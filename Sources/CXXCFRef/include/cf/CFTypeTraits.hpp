@@ -0,0 +1,137 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFBase.h>
+#include <CoreFoundation/CFData.h>
+#include <CoreFoundation/CFNumber.h>
+#include <CoreFoundation/CFString.h>
+
+#include <cassert>
+#include <type_traits>
+
+/// Set to 1 to assert that elements read from Core Foundation collections by typed views match the view's element
+/// type. Defaults to 1 unless NDEBUG is defined.
+#ifndef CXXCFREF_CHECK_ELEMENT_TYPES
+#ifdef NDEBUG
+#define CXXCFREF_CHECK_ELEMENT_TYPES 0
+#else
+#define CXXCFREF_CHECK_ELEMENT_TYPES 1
+#endif
+#endif
+
+namespace cf {
+
+/// Maps a Core Foundation object type to the function returning its type identifier.
+///
+/// Specializations provide `static CFTypeID getTypeID() noexcept`. Those for allocators, booleans, data, null,
+/// numbers, and strings are declared here; the rest are declared by the header for each family of types, such as
+/// CFRefCollections.hpp, which must be included wherever the specialization is used. CFRef.hpp includes them all.
+template <typename T> struct type_id_traits;
+
+/// Detects whether `type_id_traits` is specialized for `T`.
+template <typename T, typename = void> struct has_type_id : std::false_type {};
+
+template <typename T>
+struct has_type_id<T, std::void_t<decltype(type_id_traits<T>::getTypeID())>> : std::true_type {};
+
+/// True if `type_id_traits` is specialized for `T`.
+template <typename T> inline constexpr bool has_type_id_v = has_type_id<T>::value;
+
+/// Detects Core Foundation types whose instances are never deallocated.
+///
+/// The only instances of CFBoolean and CFNull are the constants `kCFBooleanTrue`, `kCFBooleanFalse`, and `kCFNull`,
+/// so CFRef skips CFRetain and CFRelease for these types. Specialize only for types with no other instances.
+template <typename T> struct is_immortal_type : std::false_type {};
+
+template <> struct is_immortal_type<CFBooleanRef> : std::true_type {};
+template <> struct is_immortal_type<CFNullRef> : std::true_type {};
+
+/// True if the instances of `T` are never deallocated.
+template <typename T> inline constexpr bool is_immortal_type_v = is_immortal_type<T>::value;
+
+/// Detects mutable Core Foundation types.
+///
+/// A mutable type shares the type identifier of its immutable counterpart, so a type identifier check cannot tell
+/// whether an object of that type is actually mutable. Specializations are declared alongside `type_id_traits`.
+template <typename T> struct is_mutable_type : std::false_type {};
+
+/// True if `T` is a mutable Core Foundation type.
+template <typename T> inline constexpr bool is_mutable_type_v = is_mutable_type<T>::value;
+
+/// Returns the Core Foundation type identifier for `T`.
+///
+/// The identifier is obtained once per process and cached.
+/// @return The type identifier for `T`.
+template <typename T> [[nodiscard]] CFTypeID type_id() noexcept;
+
+namespace detail {
+
+/// Converts an untyped collection element to `E`.
+///
+/// If CXXCFREF_CHECK_ELEMENT_TYPES is set and `E` has a known type identifier, asserts that the element has it.
+/// @param value A Core Foundation object or null.
+/// @return `value` as an `E`.
+template <typename E> E _Nullable element_cast(const void *_Nullable value) noexcept;
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <typename T> inline CFTypeID type_id() noexcept {
+    static const CFTypeID typeID = type_id_traits<T>::getTypeID();
+    return typeID;
+}
+
+template <typename E> inline E _Nullable detail::element_cast(const void *_Nullable value) noexcept {
+#if CXXCFREF_CHECK_ELEMENT_TYPES
+    if constexpr (has_type_id_v<E>) {
+        assert(value == nullptr || CFGetTypeID(value) == type_id<E>());
+    }
+#endif
+    return static_cast<E>(const_cast<void *>(value));
+}
+
+// MARK: - Specializations
+
+// These are the types CFRef itself needs. The family headers declare the rest.
+//
+// Core Foundation does not distinguish mutable from immutable instances by type identifier, so mutable types share
+// the identifier of their immutable counterparts.
+
+template <> struct type_id_traits<CFAllocatorRef> {
+    static CFTypeID getTypeID() noexcept { return CFAllocatorGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFBooleanRef> {
+    static CFTypeID getTypeID() noexcept { return CFBooleanGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFDataRef> {
+    static CFTypeID getTypeID() noexcept { return CFDataGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableDataRef> : type_id_traits<CFDataRef> {};
+template <> struct is_mutable_type<CFMutableDataRef> : std::true_type {};
+
+template <> struct type_id_traits<CFNullRef> {
+    static CFTypeID getTypeID() noexcept { return CFNullGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFNumberRef> {
+    static CFTypeID getTypeID() noexcept { return CFNumberGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFStringRef> {
+    static CFTypeID getTypeID() noexcept { return CFStringGetTypeID(); }
+};
+
+template <> struct type_id_traits<CFMutableStringRef> : type_id_traits<CFStringRef> {};
+template <> struct is_mutable_type<CFMutableStringRef> : std::true_type {};
+
+} /* namespace cf */
@@ -0,0 +1,309 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFRefMisc.hpp"
+#include "CFRefRunLoop.hpp"
+#include "CFRefStreams.hpp"
+#include "CFRefStrings.hpp"
+#include "SwiftInterop.hpp"
+
+namespace cf {
+
+/// An RAII wrapper providing unique ownership semantics for Core Foundation reference-counted types.
+///
+/// CFUniqueRef owns one reference to its managed object and is move-only, so it can never cause CFRetain traffic
+/// by accident. Other references to the same object may exist elsewhere; only this handle is unique. Swift imports
+/// it as a `~Copyable` type, so passing it across the language boundary never retains or releases the object.
+/// As with CFRef, objects of immortal types are never retained or released.
+template <typename T> class CXXCFREF_TRIVIAL_ABI CXXCFREF_SWIFT_NONCOPYABLE CFUniqueRef final {
+  public:
+    static_assert(std::is_pointer_v<T>, "CFUniqueRef only supports Core Foundation opaque objects");
+#if __has_feature(objc_arc)
+    static_assert(!std::is_convertible_v<T, id>, "Use ARC for Objective-C types");
+#endif
+
+    /// The managed Core Foundation object type.
+    using element_type = T;
+
+    // MARK: Factory Methods
+
+    /// Constructs and returns a CFUniqueRef for an owned object.
+    ///
+    /// The CFUniqueRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    /// @return A CFUniqueRef object.
+    static CFUniqueRef adopt(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs and returns a CFUniqueRef for an unowned object.
+    ///
+    /// The CFUniqueRef retains the passed object using CFRetain and assumes responsibility for releasing it using
+    /// CFRelease.
+    /// @param object A Core Foundation object or null.
+    /// @return A CFUniqueRef object.
+    static CFUniqueRef retain(T _Nullable object) noexcept;
+
+    // MARK: Construction and Destruction
+
+    /// Constructs an empty CFUniqueRef with a null managed object.
+    CFUniqueRef() noexcept = default;
+
+    /// Constructs an empty CFUniqueRef with a null managed object.
+    CFUniqueRef(std::nullptr_t) noexcept;
+
+    /// Constructs a CFUniqueRef with an owned object.
+    ///
+    /// The CFUniqueRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    explicit CFUniqueRef(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs a CFUniqueRef with an unowned object.
+    ///
+    /// The CFUniqueRef retains the passed object using CFRetain and assumes responsibility for releasing it using
+    /// CFRelease.
+    /// @param object A Core Foundation object or null.
+    CFUniqueRef(T _Nullable object, retain_t /*unused*/) noexcept;
+
+    /// Constructs a CFUniqueRef by taking ownership of the reference held by a CFRef.
+    /// @param other A CFRef object.
+    explicit CFUniqueRef(CFRef<T> &&other) noexcept;
+
+    // Without these, an lvalue would convert through the managed object and adopt a reference it does not own
+    CFUniqueRef(const CFRef<T> &other) = delete;
+    explicit operator CFRef<T>() const & = delete;
+
+    CFUniqueRef(const CFUniqueRef &) = delete;
+    CFUniqueRef &operator=(const CFUniqueRef &) = delete;
+
+    /// Constructs a CFUniqueRef by moving an existing CFUniqueRef.
+    /// @param other A CFUniqueRef object.
+    CFUniqueRef(CFUniqueRef &&other) noexcept;
+
+    /// Replaces the managed object with the managed object from another CFUniqueRef.
+    /// @param other A CFUniqueRef object.
+    /// @return A reference to this.
+    CFUniqueRef &operator=(CFUniqueRef &&other) noexcept;
+
+    /// Destroys the CFUniqueRef and releases the managed object.
+    ~CFUniqueRef() noexcept;
+
+    // MARK: Conversion
+
+    /// Transfers the reference held by this CFUniqueRef to a CFRef.
+    [[nodiscard]] explicit operator CFRef<T>() && noexcept;
+
+    // MARK: Core Foundation Object Management
+
+    /// Returns true if the managed object is not null.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the managed object.
+    [[nodiscard, clang::cf_returns_not_retained]] operator T() const noexcept;
+
+    /// Returns true if the managed object is equal to the managed object from another CFUniqueRef.
+    ///
+    /// Objects are compared as by `CFRef::isEqual`.
+    /// @param other A CFUniqueRef object.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(const CFUniqueRef &other) const noexcept;
+
+    /// Returns true if the managed object is equal to a CFTypeRef.
+    ///
+    /// Objects are compared as by `CFRef::isEqual`.
+    /// @param other A Core Foundation object or null.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(CFTypeRef _Nullable other) const noexcept;
+
+    /// Returns the managed object.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_not_retained]] T _Nullable get() const & noexcept;
+
+    /// Returns the managed object.
+    ///
+    /// Swift imports this as the computed property `object`, which reads the managed object in place instead of
+    /// copying the wrapper, and receives the bridged object, such as `CFString?`, without a transfer of ownership.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_not_retained]] CXXCFREF_SWIFT_COMPUTED_PROPERTY T _Nullable
+    getObject() const & noexcept;
+
+    /// Resets the managed object and returns a pointer to the internal storage.
+    ///
+    /// The CFUniqueRef will assume responsibility for releasing any object written to its storage using CFRelease.
+    /// @return A pointer to a null Core Foundation object.
+    [[nodiscard]] T _Nullable *_Nonnull put() & noexcept;
+
+    /// Replaces the managed object with another owned object.
+    ///
+    /// The CFUniqueRef assumes responsibility for releasing the passed object using CFRelease.
+    /// @param object A Core Foundation object or null.
+    void reset(T _Nullable object [[clang::cf_consumed]] = nullptr) noexcept;
+
+    /// Swaps the managed object with the managed object from another CFUniqueRef.
+    /// @param other A CFUniqueRef object.
+    void swap(CFUniqueRef &other) noexcept;
+
+    /// Relinquishes ownership of the managed object and returns it.
+    ///
+    /// The caller assumes responsibility for releasing the returned object using CFRelease. Objects of immortal types
+    /// are never retained, so no reference is transferred for them and releasing one is unnecessary.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_retained]] T _Nullable leak() noexcept;
+
+    T _Nullable get() const && = delete;
+    T _Nullable getObject() const && = delete;
+    T _Nullable *_Nonnull put() && = delete;
+
+  private:
+    /// The managed Core Foundation object.
+    T object_{nullptr};
+};
+
+// MARK: - Implementation -
+
+// MARK: Factory Methods
+
+template <typename T> inline auto CFUniqueRef<T>::adopt(T _Nullable object) noexcept -> CFUniqueRef {
+    return CFUniqueRef(object);
+}
+
+template <typename T> inline auto CFUniqueRef<T>::retain(T _Nullable object) noexcept -> CFUniqueRef {
+    return CFUniqueRef(object, cf::retain);
+}
+
+// MARK: Construction and Destruction
+
+template <typename T> inline CFUniqueRef<T>::CFUniqueRef(std::nullptr_t) noexcept {}
+
+template <typename T> inline CFUniqueRef<T>::CFUniqueRef(T _Nullable object) noexcept : object_{object} {}
+
+template <typename T>
+inline CFUniqueRef<T>::CFUniqueRef(T _Nullable object, retain_t /*unused*/) noexcept
+    : object_{detail::retain_object(object)} {}
+
+template <typename T> inline CFUniqueRef<T>::CFUniqueRef(CFRef<T> &&other) noexcept : object_{other.leak()} {}
+
+template <typename T> inline CFUniqueRef<T>::CFUniqueRef(CFUniqueRef &&other) noexcept : object_{other.leak()} {}
+
+template <typename T> inline auto CFUniqueRef<T>::operator=(CFUniqueRef &&other) noexcept -> CFUniqueRef & {
+    reset(other.leak());
+    return *this;
+}
+
+template <typename T> inline CFUniqueRef<T>::~CFUniqueRef() noexcept { reset(); }
+
+// MARK: Conversion
+
+template <typename T> inline CFUniqueRef<T>::operator CFRef<T>() && noexcept { return CFRef<T>::adopt(leak()); }
+
+// MARK: Core Foundation Object Management
+
+template <typename T> inline CFUniqueRef<T>::operator bool() const noexcept { return object_ != nullptr; }
+
+template <typename T> inline CFUniqueRef<T>::operator T() const noexcept { return object_; }
+
+template <typename T> inline bool CFUniqueRef<T>::isEqual(const CFUniqueRef &other) const noexcept {
+    if (object_ == other.object_) {
+        return true;
+    }
+    return object_ != nullptr && other.object_ != nullptr && detail::comparator<T>::equal(object_, other.object_);
+}
+
+template <typename T> inline bool CFUniqueRef<T>::isEqual(CFTypeRef _Nullable other) const noexcept {
+    if (static_cast<CFTypeRef>(object_) == other) {
+        return true;
+    }
+    return object_ != nullptr && other != nullptr && detail::comparator<T>::equal(object_, other);
+}
+
+template <typename T> inline T _Nullable CFUniqueRef<T>::get() const & noexcept { return object_; }
+
+template <typename T> inline T _Nullable CFUniqueRef<T>::getObject() const & noexcept { return object_; }
+
+template <typename T> inline T _Nullable *_Nonnull CFUniqueRef<T>::put() & noexcept {
+    reset();
+    return &object_;
+}
+
+template <typename T> inline void CFUniqueRef<T>::reset(T _Nullable object) noexcept {
+    detail::release_object(std::exchange(object_, object));
+}
+
+template <typename T> inline void CFUniqueRef<T>::swap(CFUniqueRef &other) noexcept {
+    std::swap(object_, other.object_);
+}
+
+template <typename T> inline T _Nullable CFUniqueRef<T>::leak() noexcept { return std::exchange(object_, nullptr); }
+
+/// CFUniqueRef holds a single pointer and is trivially relocatable.
+template <typename T> struct is_trivially_relocatable<CFUniqueRef<T>> : std::true_type {};
+
+// MARK: - Common Core Foundation Types
+
+using CFUniqueAllocator = CFUniqueRef<CFAllocatorRef>;
+using CFUniqueArray = CFUniqueRef<CFArrayRef>;
+using CFUniqueAttributedString = CFUniqueRef<CFAttributedStringRef>;
+using CFUniqueBag = CFUniqueRef<CFBagRef>;
+using CFUniqueBinaryHeap = CFUniqueRef<CFBinaryHeapRef>;
+using CFUniqueBitVector = CFUniqueRef<CFBitVectorRef>;
+using CFUniqueBoolean = CFUniqueRef<CFBooleanRef>;
+using CFUniqueBundle = CFUniqueRef<CFBundleRef>;
+using CFUniqueCalendar = CFUniqueRef<CFCalendarRef>;
+using CFUniqueCharacterSet = CFUniqueRef<CFCharacterSetRef>;
+using CFUniqueData = CFUniqueRef<CFDataRef>;
+using CFUniqueDate = CFUniqueRef<CFDateRef>;
+using CFUniqueDateFormatter = CFUniqueRef<CFDateFormatterRef>;
+using CFUniqueDictionary = CFUniqueRef<CFDictionaryRef>;
+using CFUniqueError = CFUniqueRef<CFErrorRef>;
+using CFUniqueFileDescriptor = CFUniqueRef<CFFileDescriptorRef>;
+using CFUniqueFileSecurity = CFUniqueRef<CFFileSecurityRef>;
+using CFUniqueLocale = CFUniqueRef<CFLocaleRef>;
+using CFUniqueMachPort = CFUniqueRef<CFMachPortRef>;
+using CFUniqueMessagePort = CFUniqueRef<CFMessagePortRef>;
+using CFUniqueMutableArray = CFUniqueRef<CFMutableArrayRef>;
+using CFUniqueMutableAttributedString = CFUniqueRef<CFMutableAttributedStringRef>;
+using CFUniqueMutableBag = CFUniqueRef<CFMutableBagRef>;
+using CFUniqueMutableBitVector = CFUniqueRef<CFMutableBitVectorRef>;
+using CFUniqueMutableCharacterSet = CFUniqueRef<CFMutableCharacterSetRef>;
+using CFUniqueMutableData = CFUniqueRef<CFMutableDataRef>;
+using CFUniqueMutableDictionary = CFUniqueRef<CFMutableDictionaryRef>;
+using CFUniqueMutableSet = CFUniqueRef<CFMutableSetRef>;
+using CFUniqueMutableString = CFUniqueRef<CFMutableStringRef>;
+using CFUniqueNotificationCenter = CFUniqueRef<CFNotificationCenterRef>;
+using CFUniqueNull = CFUniqueRef<CFNullRef>;
+using CFUniqueNumber = CFUniqueRef<CFNumberRef>;
+using CFUniqueNumberFormatter = CFUniqueRef<CFNumberFormatterRef>;
+using CFUniquePlugIn = CFUniqueRef<CFPlugInRef>;
+using CFUniquePlugInInstance = CFUniqueRef<CFPlugInInstanceRef>;
+using CFUniquePropertyList = CFUniqueRef<CFPropertyListRef>;
+using CFUniqueReadStream = CFUniqueRef<CFReadStreamRef>;
+using CFUniqueRunLoop = CFUniqueRef<CFRunLoopRef>;
+using CFUniqueRunLoopObserver = CFUniqueRef<CFRunLoopObserverRef>;
+using CFUniqueRunLoopSource = CFUniqueRef<CFRunLoopSourceRef>;
+using CFUniqueRunLoopTimer = CFUniqueRef<CFRunLoopTimerRef>;
+using CFUniqueSet = CFUniqueRef<CFSetRef>;
+using CFUniqueSocket = CFUniqueRef<CFSocketRef>;
+using CFUniqueString = CFUniqueRef<CFStringRef>;
+using CFUniqueStringTokenizer = CFUniqueRef<CFStringTokenizerRef>;
+using CFUniqueTimeZone = CFUniqueRef<CFTimeZoneRef>;
+using CFUniqueTree = CFUniqueRef<CFTreeRef>;
+using CFUniqueURL = CFUniqueRef<CFURLRef>;
+using CFUniqueUserNotification = CFUniqueRef<CFUserNotificationRef>;
+using CFUniqueURLEnumerator = CFUniqueRef<CFURLEnumeratorRef>;
+using CFUniqueUUID = CFUniqueRef<CFUUIDRef>;
+using CFUniqueWriteStream = CFUniqueRef<CFWriteStreamRef>;
+using CFUniqueXMLNode = CFUniqueRef<CFXMLNodeRef>;
+using CFUniqueXMLParser = CFUniqueRef<CFXMLParserRef>;
+using CFUniqueXMLTree = CFUniqueRef<CFXMLTreeRef>;
+
+} /* namespace cf */
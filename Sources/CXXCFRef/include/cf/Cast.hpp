@@ -0,0 +1,100 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+
+namespace cf {
+
+/// Returns true if an object is an instance of `T`.
+///
+/// The type identifier of `T` is cached, so the check costs one call to CFGetTypeID. Mutable types share the
+/// identifier of their immutable counterparts, so `isa<CFMutableStringRef>` is true for any CFString; for this
+/// reason `dyn_cast` and `cast` reject mutable target types.
+/// @param object A Core Foundation object or null.
+/// @return true if `object` is non-null and an instance of `T`.
+template <typename T> [[nodiscard]] bool isa(CFTypeRef _Nullable object) noexcept;
+
+/// Returns an object as a `T` if it is an instance of `T`.
+///
+/// `T` may not be a mutable type, since an immutable object would pass the check and mutating it is undefined.
+/// @param object A Core Foundation object or null.
+/// @return `object` as a borrowed `T`, or null if `object` is null or not an instance of `T`.
+template <typename T>
+[[nodiscard, clang::cf_returns_not_retained]] T _Nullable dyn_cast(CFTypeRef _Nullable object) noexcept;
+
+/// Returns the managed object of a CFRef as a `T` if it is an instance of `T`.
+/// @param ref A CFRef.
+/// @return The managed object as a borrowed `T`, or null if it is null or not an instance of `T`.
+template <typename T, typename U>
+[[nodiscard, clang::cf_returns_not_retained]] T _Nullable dyn_cast(const CFRef<U> &ref) noexcept;
+
+/// Returns a retained CFRef managing an object if it is an instance of `R::element_type`.
+///
+/// `R` must be a CFRef of an immutable type, for example `cf::cast<cf::CFString>(value)`.
+/// @param object A Core Foundation object or null.
+/// @return A CFRef managing `object`, or an empty CFRef if `object` is null or of a different type.
+template <typename R> [[nodiscard]] R cast(CFTypeRef _Nullable object) noexcept;
+
+/// Returns a CFRef sharing ownership of the managed object of another CFRef if it is an instance of
+/// `R::element_type`.
+/// @param ref A CFRef.
+/// @return A CFRef managing the object, or an empty CFRef if it is null or of a different type.
+template <typename R, typename U> [[nodiscard]] R cast(const CFRef<U> &ref) noexcept;
+
+/// Returns a CFRef taking ownership of the managed object of another CFRef if it is an instance of
+/// `R::element_type`.
+///
+/// `ref` is left empty on success and unchanged on failure.
+/// @param ref A CFRef.
+/// @return A CFRef managing the object, or an empty CFRef if it is null or of a different type.
+template <typename R, typename U> [[nodiscard]] R cast(CFRef<U> &&ref) noexcept;
+
+// MARK: - Implementation -
+
+template <typename T> inline bool isa(CFTypeRef _Nullable object) noexcept {
+    if constexpr (std::is_same_v<T, CFTypeRef>) {
+        return object != nullptr;
+    } else {
+        static_assert(has_type_id_v<T>, "isa requires a type with a type_id_traits specialization");
+        return object != nullptr && CFGetTypeID(object) == type_id<T>();
+    }
+}
+
+template <typename T> inline T _Nullable dyn_cast(CFTypeRef _Nullable object) noexcept {
+    static_assert(!is_mutable_type_v<T>,
+                  "Type identifiers do not distinguish mutable objects; cast to the immutable type and copy it");
+    return isa<T>(object) ? static_cast<T>(const_cast<void *>(object)) : nullptr;
+}
+
+template <typename T, typename U> inline T _Nullable dyn_cast(const CFRef<U> &ref) noexcept {
+    return dyn_cast<T>(static_cast<CFTypeRef>(ref.get()));
+}
+
+template <typename R> inline R cast(CFTypeRef _Nullable object) noexcept {
+    return R::retain(dyn_cast<typename R::element_type>(object));
+}
+
+template <typename R, typename U> inline R cast(const CFRef<U> &ref) noexcept {
+    return cast<R>(static_cast<CFTypeRef>(ref.get()));
+}
+
+template <typename R, typename U> inline R cast(CFRef<U> &&ref) noexcept {
+    using T = typename R::element_type;
+    static_assert(!is_mutable_type_v<T>,
+                  "Type identifiers do not distinguish mutable objects; cast to the immutable type and copy it");
+    if (!isa<T>(static_cast<CFTypeRef>(ref.get()))) {
+        return {};
+    }
+    return R::adopt(static_cast<T>(const_cast<void *>(static_cast<const void *>(ref.leak()))));
+}
+
+} /* namespace cf */
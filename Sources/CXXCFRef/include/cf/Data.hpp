@@ -0,0 +1,84 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CFRefCore.hpp"
+#include "Span.hpp"
+
+namespace cf {
+
+// MARK: Views
+
+/// Returns a view of the bytes of a CFData.
+///
+/// The view is valid as long as the data is alive and unmodified.
+/// @param data A CFData or null.
+/// @return A view of the bytes, or an empty view if `data` is null.
+[[nodiscard]] span<const std::uint8_t> bytes(CFDataRef _Nullable data) noexcept;
+
+/// Returns a mutable view of the bytes of a CFMutableData.
+///
+/// The view is valid as long as the data is alive and its length is unchanged.
+/// @param data A CFMutableData or null.
+/// @return A view of the bytes, or an empty view if `data` is null.
+[[nodiscard]] span<std::uint8_t> mutable_bytes(CFMutableDataRef _Nullable data) noexcept;
+
+// MARK: Ownership Transfer
+
+/// Creates a CFData that takes ownership of the storage of a vector without copying it.
+///
+/// The vector's storage is freed when the CFData is deallocated.
+/// @param bytes The vector whose storage is transferred; it is left empty.
+/// @return A CFData containing the bytes of `bytes`, or null on failure.
+[[nodiscard]] CFData data_from(std::vector<std::uint8_t> &&bytes);
+
+/// Creates a CFData that refers to bytes owned by the caller without copying them.
+///
+/// The bytes must remain valid and unmodified for the lifetime of the CFData, including any references retained
+/// by code it is passed to.
+/// @param bytes The bytes.
+/// @return A CFData containing `bytes`, or null on failure.
+[[nodiscard]] CFData borrowed_data(span<const std::uint8_t> bytes) noexcept;
+
+/// Copies the bytes of a CFData into a vector.
+///
+/// CFData does not allow its storage to be taken over, so this performs exactly one copy.
+/// @param data A CFData or null.
+/// @return A vector containing the bytes of `data`.
+[[nodiscard]] std::vector<std::uint8_t> to_vector(CFDataRef _Nullable data);
+
+// MARK: - Implementation -
+
+inline span<const std::uint8_t> bytes(CFDataRef _Nullable data) noexcept {
+    if (data == nullptr) {
+        return {};
+    }
+    return {CFDataGetBytePtr(data), static_cast<std::size_t>(CFDataGetLength(data))};
+}
+
+inline span<std::uint8_t> mutable_bytes(CFMutableDataRef _Nullable data) noexcept {
+    if (data == nullptr) {
+        return {};
+    }
+    return {CFDataGetMutableBytePtr(data), static_cast<std::size_t>(CFDataGetLength(data))};
+}
+
+inline CFData borrowed_data(span<const std::uint8_t> bytes) noexcept {
+    return CFData::adopt(CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, bytes.data(),
+                                                     static_cast<CFIndex>(bytes.size()), kCFAllocatorNull));
+}
+
+inline std::vector<std::uint8_t> to_vector(CFDataRef _Nullable data) {
+    const auto view = bytes(data);
+    return std::vector<std::uint8_t>(view.begin(), view.end());
+}
+
+} /* namespace cf */
@@ -0,0 +1,144 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cf {
+
+/// A lock-free queue of Core Foundation objects awaiting release on a background thread.
+///
+/// Objects may be enqueued from any number of threads, including real-time threads: enqueueing never allocates,
+/// blocks, or calls CFRelease. A background thread owned by the queue drains it in batches at a fixed interval.
+/// The queue has a fixed capacity; `release` falls back to an inline CFRelease if it is full.
+class DeferredRelease final {
+  public:
+    /// The default maximum number of queued objects.
+    static constexpr std::size_t defaultCapacity = 4096;
+
+    /// The default interval between background drains.
+    static constexpr std::chrono::milliseconds defaultInterval{10};
+
+    /// Returns the process-wide deferred release queue.
+    ///
+    /// The first call creates the queue and starts its drain thread, so it should not happen on a real-time thread.
+    /// @return The shared queue.
+    static DeferredRelease &shared();
+
+    /// Constructs a queue and starts its drain thread.
+    /// @param capacity The maximum number of queued objects, rounded up to a power of two.
+    /// @param interval The interval between background drains.
+    explicit DeferredRelease(std::size_t capacity = defaultCapacity,
+                             std::chrono::milliseconds interval = defaultInterval);
+
+    DeferredRelease(const DeferredRelease &) = delete;
+    DeferredRelease &operator=(const DeferredRelease &) = delete;
+
+    /// Stops the drain thread and releases any objects remaining in the queue.
+    ~DeferredRelease() noexcept;
+
+    /// Enqueues an object for release on the drain thread.
+    ///
+    /// If the queue is full the object is released immediately using CFRelease.
+    /// @param object A Core Foundation object or null.
+    void release(CFTypeRef _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Attempts to enqueue an object for release on the drain thread.
+    ///
+    /// The queue assumes responsibility for releasing the object only if this function returns true.
+    /// @param object A Core Foundation object.
+    /// @return true if the object was enqueued, false if the queue is full.
+    [[nodiscard]] bool tryEnqueue(CFTypeRef _Nonnull object) noexcept;
+
+    /// Releases all objects currently in the queue on the calling thread.
+    /// @return The number of objects released.
+    std::size_t drain() noexcept;
+
+    /// Returns the number of objects released inline because the queue was full.
+    [[nodiscard]] std::size_t overflowCount() const noexcept;
+
+  private:
+    /// A queue slot.
+    struct Cell {
+        /// The slot's sequence number, used to detect whether it is full or empty.
+        std::atomic<std::size_t> sequence;
+        /// The queued object.
+        CFTypeRef _Nullable object;
+    };
+
+    /// Dequeues one object.
+    /// @param object On success, the dequeued object.
+    /// @return true if an object was dequeued, false if the queue is empty.
+    bool dequeue(CFTypeRef _Nullable &object) noexcept;
+
+    /// The drain thread and its synchronization state.
+    struct Drainer;
+
+    /// The constructive interference size used to keep producer and consumer positions on separate cache lines.
+    static constexpr std::size_t cacheLineSize = 128;
+
+    /// The queue slots.
+    std::unique_ptr<Cell[]> cells_;
+    /// The index mask for `cells_`.
+    std::size_t mask_{0};
+    /// The position of the next enqueue.
+    alignas(cacheLineSize) std::atomic<std::size_t> enqueuePosition_{0};
+    /// The position of the next dequeue.
+    alignas(cacheLineSize) std::atomic<std::size_t> dequeuePosition_{0};
+    /// The number of objects released inline because the queue was full.
+    alignas(cacheLineSize) std::atomic<std::size_t> overflowCount_{0};
+    /// The drain thread.
+    std::unique_ptr<Drainer> drainer_;
+};
+
+// MARK: - Implementation -
+
+inline void DeferredRelease::release(CFTypeRef _Nullable object) noexcept {
+    if (object == nullptr) {
+        return;
+    }
+    if (!tryEnqueue(object)) {
+        overflowCount_.fetch_add(1, std::memory_order_relaxed);
+        CFRelease(object);
+    }
+}
+
+inline bool DeferredRelease::tryEnqueue(CFTypeRef _Nonnull object) noexcept {
+    auto position = enqueuePosition_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &cells_[position & mask_];
+        const auto sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0) {
+            if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return false;
+        } else {
+            position = enqueuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->object = object;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+inline std::size_t DeferredRelease::overflowCount() const noexcept {
+    return overflowCount_.load(std::memory_order_relaxed);
+}
+
+} /* namespace cf */
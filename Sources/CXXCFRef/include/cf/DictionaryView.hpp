@@ -0,0 +1,262 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+#include "SmallBuffer.hpp"
+
+namespace cf {
+
+/// A non-owning, typed view of the key-value pairs of a CFDictionary.
+///
+/// All keys and values are fetched with a single call to CFDictionaryGetKeysAndValues when the view is constructed,
+/// into inline storage for up to `inlineCapacity` pairs. Keys and values are returned as borrowed `K` and `V` values
+/// and are never retained. The view does not retain the dictionary, which must outlive the view and must not be
+/// mutated while it is in use.
+template <typename K, typename V> class DictionaryView final {
+  public:
+    static_assert(std::is_pointer_v<K>, "DictionaryView only supports Core Foundation opaque objects");
+    static_assert(std::is_pointer_v<V>, "DictionaryView only supports Core Foundation opaque objects");
+
+    /// The key type.
+    using key_type = K;
+    /// The value type.
+    using mapped_type = V;
+    /// The element type.
+    using value_type = std::pair<K, V>;
+    /// The type used for sizes.
+    using size_type = std::size_t;
+    /// The type used for distances between iterators.
+    using difference_type = std::ptrdiff_t;
+
+    /// The number of key-value pairs that can be held without a heap allocation.
+    static constexpr std::size_t inlineCapacity = 32;
+
+    class iterator;
+
+    // MARK: Construction
+
+    /// Constructs an empty DictionaryView.
+    DictionaryView() noexcept = default;
+
+    /// Constructs a DictionaryView of a CFDictionary.
+    /// @param dictionary A CFDictionary or null.
+    explicit DictionaryView(CFDictionaryRef _Nullable dictionary);
+
+    /// Constructs a DictionaryView of the managed dictionary of a CFRef.
+    /// @param dictionary A CFRef managing a CFDictionary or CFMutableDictionary.
+    template <typename D, typename = std::enable_if_t<std::is_convertible_v<D, CFDictionaryRef>>>
+    DictionaryView(const CFRef<D> &dictionary);
+
+    template <typename D, typename = std::enable_if_t<std::is_convertible_v<D, CFDictionaryRef>>>
+    DictionaryView(CFRef<D> &&dictionary) = delete;
+
+    // MARK: Element Access
+
+    /// Returns the number of key-value pairs.
+    [[nodiscard]] size_type size() const noexcept;
+
+    /// Returns true if the view contains no key-value pairs.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns the key at `index` in iteration order without retaining it.
+    [[nodiscard, clang::cf_returns_not_retained]] K _Nullable key(size_type index) const noexcept;
+
+    /// Returns the value at `index` in iteration order without retaining it.
+    [[nodiscard, clang::cf_returns_not_retained]] V _Nullable value(size_type index) const noexcept;
+
+    /// Returns the key-value pair at `index` in iteration order without retaining it.
+    [[nodiscard]] value_type operator[](size_type index) const noexcept;
+
+    /// Returns the value for a key without retaining it.
+    /// @param key The key to look up.
+    /// @return The value for `key`, or null if the dictionary does not contain `key`.
+    [[nodiscard, clang::cf_returns_not_retained]] V _Nullable find(K _Nonnull key) const noexcept;
+
+    /// Returns true if the dictionary contains a key.
+    [[nodiscard]] bool contains(K _Nonnull key) const noexcept;
+
+    /// Returns the dictionary.
+    [[nodiscard, clang::cf_returns_not_retained]] CFDictionaryRef _Nullable dictionary() const noexcept;
+
+    // MARK: Iteration
+
+    /// Returns an iterator to the first key-value pair.
+    [[nodiscard]] iterator begin() const noexcept;
+
+    /// Returns an iterator past the last key-value pair.
+    [[nodiscard]] iterator end() const noexcept;
+
+  private:
+    /// The dictionary.
+    CFDictionaryRef _Nullable dictionary_{nullptr};
+    /// The number of key-value pairs.
+    std::size_t count_{0};
+    /// The keys followed by the values.
+    detail::SmallBuffer<const void *, 2 * inlineCapacity> pairs_;
+};
+
+/// A random access iterator over a DictionaryView.
+///
+/// Dereferencing yields a `std::pair<K, V>` by value.
+template <typename K, typename V> class DictionaryView<K, V>::iterator final {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<K, V>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    iterator() noexcept = default;
+
+    [[nodiscard]] value_type operator*() const noexcept { return (*view_)[index_]; }
+    [[nodiscard]] value_type operator[](difference_type offset) const noexcept {
+        return (*view_)[index_ + static_cast<std::size_t>(offset)];
+    }
+
+    iterator &operator++() noexcept {
+        ++index_;
+        return *this;
+    }
+    iterator operator++(int) noexcept {
+        auto result = *this;
+        ++index_;
+        return result;
+    }
+    iterator &operator--() noexcept {
+        --index_;
+        return *this;
+    }
+    iterator operator--(int) noexcept {
+        auto result = *this;
+        --index_;
+        return result;
+    }
+    iterator &operator+=(difference_type offset) noexcept {
+        index_ += static_cast<std::size_t>(offset);
+        return *this;
+    }
+    iterator &operator-=(difference_type offset) noexcept {
+        index_ -= static_cast<std::size_t>(offset);
+        return *this;
+    }
+
+    [[nodiscard]] friend iterator operator+(iterator it, difference_type offset) noexcept { return it += offset; }
+    [[nodiscard]] friend iterator operator+(difference_type offset, iterator it) noexcept { return it += offset; }
+    [[nodiscard]] friend iterator operator-(iterator it, difference_type offset) noexcept { return it -= offset; }
+    [[nodiscard]] friend difference_type operator-(const iterator &lhs, const iterator &rhs) noexcept {
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+
+    [[nodiscard]] friend bool operator==(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ == rhs.index_;
+    }
+    [[nodiscard]] friend bool operator!=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ != rhs.index_;
+    }
+    [[nodiscard]] friend bool operator<(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ < rhs.index_;
+    }
+    [[nodiscard]] friend bool operator>(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ > rhs.index_;
+    }
+    [[nodiscard]] friend bool operator<=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ <= rhs.index_;
+    }
+    [[nodiscard]] friend bool operator>=(const iterator &lhs, const iterator &rhs) noexcept {
+        return lhs.index_ >= rhs.index_;
+    }
+
+  private:
+    friend class DictionaryView;
+
+    iterator(const DictionaryView *_Nonnull view, std::size_t index) noexcept : view_{view}, index_{index} {}
+
+    /// The view.
+    const DictionaryView *_Nullable view_{nullptr};
+    /// The current index.
+    std::size_t index_{0};
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction
+
+template <typename K, typename V>
+inline DictionaryView<K, V>::DictionaryView(CFDictionaryRef _Nullable dictionary)
+    : dictionary_{dictionary},
+      count_{dictionary != nullptr ? static_cast<std::size_t>(CFDictionaryGetCount(dictionary)) : 0},
+      pairs_(2 * count_) {
+    if (count_ != 0) {
+        CFDictionaryGetKeysAndValues(dictionary_, pairs_.data(), pairs_.data() + count_);
+    }
+}
+
+template <typename K, typename V>
+template <typename D, typename>
+inline DictionaryView<K, V>::DictionaryView(const CFRef<D> &dictionary)
+    : DictionaryView(static_cast<CFDictionaryRef>(dictionary.get())) {}
+
+// MARK: Element Access
+
+template <typename K, typename V> inline auto DictionaryView<K, V>::size() const noexcept -> size_type {
+    return count_;
+}
+
+template <typename K, typename V> inline bool DictionaryView<K, V>::empty() const noexcept { return count_ == 0; }
+
+template <typename K, typename V> inline K _Nullable DictionaryView<K, V>::key(size_type index) const noexcept {
+    assert(index < count_);
+    return detail::element_cast<K>(pairs_[index]);
+}
+
+template <typename K, typename V> inline V _Nullable DictionaryView<K, V>::value(size_type index) const noexcept {
+    assert(index < count_);
+    return detail::element_cast<V>(pairs_[count_ + index]);
+}
+
+template <typename K, typename V>
+inline auto DictionaryView<K, V>::operator[](size_type index) const noexcept -> value_type {
+    return {key(index), value(index)};
+}
+
+template <typename K, typename V> inline V _Nullable DictionaryView<K, V>::find(K _Nonnull key) const noexcept {
+    if (dictionary_ == nullptr) {
+        return nullptr;
+    }
+    return detail::element_cast<V>(CFDictionaryGetValue(dictionary_, static_cast<const void *>(key)));
+}
+
+template <typename K, typename V> inline bool DictionaryView<K, V>::contains(K _Nonnull key) const noexcept {
+    return dictionary_ != nullptr && CFDictionaryContainsKey(dictionary_, static_cast<const void *>(key));
+}
+
+template <typename K, typename V>
+inline CFDictionaryRef _Nullable DictionaryView<K, V>::dictionary() const noexcept {
+    return dictionary_;
+}
+
+// MARK: Iteration
+
+template <typename K, typename V> inline auto DictionaryView<K, V>::begin() const noexcept -> iterator {
+    return iterator(this, 0);
+}
+
+template <typename K, typename V> inline auto DictionaryView<K, V>::end() const noexcept -> iterator {
+    return iterator(this, count_);
+}
+
+} /* namespace cf */
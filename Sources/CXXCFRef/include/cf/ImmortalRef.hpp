@@ -0,0 +1,96 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// A reference to a Core Foundation object that is never released.
+///
+/// Copying, moving, and destroying an ImmortalRef never calls CFRetain or CFRelease, so an object shared by many
+/// threads, such as a process-wide configuration dictionary, can be handed around without contending for its
+/// reference count. The object must remain alive for as long as any ImmortalRef to it is in use: it should be a
+/// constant, or be made immortal with `leak`.
+template <typename T> class ImmortalRef final {
+  public:
+    static_assert(std::is_pointer_v<T>, "ImmortalRef only supports Core Foundation opaque objects");
+
+    /// The referenced Core Foundation object type.
+    using element_type = T;
+
+    // MARK: Factory Methods
+
+    /// Takes over the reference owned by a CFRef and never releases it.
+    ///
+    /// The object is intentionally leaked and lives for the rest of the process.
+    /// @param ref A CFRef; it is left empty.
+    /// @return An ImmortalRef to the object.
+    [[nodiscard]] static ImmortalRef leak(CFRef<T> &&ref) noexcept;
+
+    // MARK: Construction
+
+    /// Constructs an ImmortalRef with a null object.
+    constexpr ImmortalRef() noexcept = default;
+
+    /// Constructs an ImmortalRef to an object that outlives every use of the reference.
+    /// @param object A Core Foundation object or null.
+    constexpr explicit ImmortalRef(T _Nullable object) noexcept;
+
+    // MARK: Core Foundation Object Management
+
+    /// Returns true if the object is not null.
+    [[nodiscard]] constexpr explicit operator bool() const noexcept;
+
+    /// Returns the object.
+    [[nodiscard, clang::cf_returns_not_retained]] constexpr operator T() const noexcept;
+
+    /// Returns the object.
+    [[nodiscard, clang::cf_returns_not_retained]] constexpr T _Nullable get() const noexcept;
+
+    /// Returns a CFRef sharing ownership of the object.
+    ///
+    /// This retains the object unless its type is immortal.
+    [[nodiscard]] explicit operator CFRef<T>() const noexcept;
+
+    /// Returns true if the object is equal to a CFTypeRef, using the same comparison as `CFRef::isEqual`.
+    /// @param other A Core Foundation object or null.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(CFTypeRef _Nullable other) const noexcept;
+
+  private:
+    /// The referenced Core Foundation object.
+    T object_{nullptr};
+};
+
+// MARK: - Implementation -
+
+template <typename T> inline auto ImmortalRef<T>::leak(CFRef<T> &&ref) noexcept -> ImmortalRef {
+    return ImmortalRef(ref.leak());
+}
+
+template <typename T> constexpr ImmortalRef<T>::ImmortalRef(T _Nullable object) noexcept : object_{object} {}
+
+template <typename T> constexpr ImmortalRef<T>::operator bool() const noexcept { return object_ != nullptr; }
+
+template <typename T> constexpr ImmortalRef<T>::operator T() const noexcept { return object_; }
+
+template <typename T> constexpr T _Nullable ImmortalRef<T>::get() const noexcept { return object_; }
+
+template <typename T> inline ImmortalRef<T>::operator CFRef<T>() const noexcept { return CFRef<T>::retain(object_); }
+
+template <typename T> inline bool ImmortalRef<T>::isEqual(CFTypeRef _Nullable other) const noexcept {
+    if (static_cast<CFTypeRef>(object_) == other) {
+        return true;
+    }
+    return object_ != nullptr && other != nullptr && detail::comparator<T>::equal(object_, other);
+}
+
+} /* namespace cf */
@@ -0,0 +1,144 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFBase.h>
+
+/// Set to 1 to count CFRef reference operations per managed type. Defaults to 0, in which case the hooks compile to
+/// nothing and the interface below is not declared. The setting changes the definition of CFRef and must be the same
+/// in every translation unit.
+#ifndef CXXCFREF_INSTRUMENTATION
+#define CXXCFREF_INSTRUMENTATION 0
+#endif
+
+/// Set to 1, together with CXXCFREF_INSTRUMENTATION, to emit an os_signpost interval around every CFRelease made by
+/// CFRef. Defaults to 0.
+#ifndef CXXCFREF_INSTRUMENTATION_SIGNPOSTS
+#define CXXCFREF_INSTRUMENTATION_SIGNPOSTS 0
+#endif
+
+#if CXXCFREF_INSTRUMENTATION
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if CXXCFREF_INSTRUMENTATION_SIGNPOSTS
+#include <os/signpost.h>
+#endif
+
+namespace cf::instrumentation {
+
+/// Reference operation counts for one managed type.
+struct TypeStatistics {
+    /// The managed type, as spelled by the compiler.
+    std::string typeName;
+    /// The number of objects adopted. Every call to `put()` counts as an adoption, whether or not an object is written.
+    std::uint64_t adopts;
+    /// The number of objects retained, including retains made by copies.
+    std::uint64_t retains;
+    /// The number of objects released.
+    std::uint64_t releases;
+    /// The number of copy constructions and copy assignments.
+    std::uint64_t copies;
+    /// The number of move constructions and move assignments.
+    std::uint64_t moves;
+    /// The number of objects relinquished with `leak()`.
+    std::uint64_t leaks;
+    /// The number of references currently held: adopts and retains minus releases and leaks.
+    std::int64_t live;
+};
+
+/// Returns the counts for every managed type that has recorded an operation.
+///
+/// Counts are read individually without stopping other threads, so a snapshot taken while references are changing
+/// may be slightly inconsistent. Types whose instances are immortal are never counted, because CFRef does not
+/// retain or release them.
+/// @return The counts per type.
+[[nodiscard]] std::vector<TypeStatistics> snapshot();
+
+/// Resets all counts to zero.
+void reset() noexcept;
+
+namespace detail {
+
+/// The counters for one managed type.
+struct Counters {
+    /// Constructs counters and adds them to the registry.
+    /// @param signature A string containing the name of the managed type.
+    explicit Counters(const char *_Nonnull signature) noexcept;
+
+    Counters(const Counters &) = delete;
+    Counters &operator=(const Counters &) = delete;
+
+    /// A string containing the name of the managed type.
+    const char *_Nonnull signature;
+    /// The next registered counters.
+    Counters *_Nullable next{nullptr};
+
+    std::atomic<std::uint64_t> adopts{0};
+    std::atomic<std::uint64_t> retains{0};
+    std::atomic<std::uint64_t> releases{0};
+    std::atomic<std::uint64_t> copies{0};
+    std::atomic<std::uint64_t> moves{0};
+    std::atomic<std::uint64_t> leaks{0};
+};
+
+/// Returns a string containing the name of `T`.
+template <typename T> [[nodiscard]] constexpr const char *_Nonnull signature() noexcept { return __PRETTY_FUNCTION__; }
+
+/// Returns the counters for `T`, registering them on first use.
+template <typename T> [[nodiscard]] Counters &counters() noexcept {
+    static Counters counters{signature<T>()};
+    return counters;
+}
+
+#if CXXCFREF_INSTRUMENTATION_SIGNPOSTS
+
+/// Returns the log used for release signposts.
+[[nodiscard]] os_log_t _Nonnull signpostLog() noexcept;
+
+#endif
+
+} /* namespace detail */
+
+} /* namespace cf::instrumentation */
+
+/// Records a reference operation on a CFRef managing `T`, unless `T` is an immortal type.
+#define CXXCFREF_RECORD(T, counter)                                                                                    \
+    do {                                                                                                               \
+        if constexpr (!::cf::is_immortal_type_v<T>) {                                                                  \
+            ::cf::instrumentation::detail::counters<T>().counter.fetch_add(1, std::memory_order_relaxed);              \
+        }                                                                                                              \
+    } while (0)
+
+#if CXXCFREF_INSTRUMENTATION_SIGNPOSTS
+
+/// Releases `object` inside an os_signpost interval.
+#define CXXCFREF_RELEASE(object)                                                                                       \
+    do {                                                                                                               \
+        const auto log_ = ::cf::instrumentation::detail::signpostLog();                                                \
+        const auto id_ = os_signpost_id_make_with_pointer(log_, object);                                               \
+        os_signpost_interval_begin(log_, id_, "CFRelease");                                                            \
+        CFRelease(object);                                                                                             \
+        os_signpost_interval_end(log_, id_, "CFRelease");                                                              \
+    } while (0)
+
+#else
+
+#define CXXCFREF_RELEASE(object) CFRelease(object)
+
+#endif /* CXXCFREF_INSTRUMENTATION_SIGNPOSTS */
+
+#else
+
+#define CXXCFREF_RECORD(T, counter) ((void)0)
+#define CXXCFREF_RELEASE(object) CFRelease(object)
+
+#endif /* CXXCFREF_INSTRUMENTATION */
@@ -0,0 +1,204 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// A thread-safe table mapping Core Foundation objects to a canonical instance with equal content.
+///
+/// Objects are compared using CFHash and CFEqual. Interning an object returns the first equal object added to the
+/// table, so canonical instances may be compared by identity and duplicates released. The table is split into
+/// shards chosen by hash, each with its own lock, so threads interning unrelated objects rarely contend.
+///
+/// The table holds a strong reference to every canonical instance until it is evicted or the table is destroyed.
+/// Canonical CFStrings and CFData are immutable copies, so interning a mutable instance never lets later changes
+/// to it corrupt the table. Other objects must not be mutated after they are interned.
+/// @tparam T A Core Foundation type such as `CFStringRef` or `CFDataRef`.
+template <typename T> class InternTable final {
+  public:
+    /// The default number of shards.
+    static constexpr std::size_t defaultShardCount = 16;
+
+    /// Constructs an empty table.
+    /// @param shardCount The number of shards, rounded up to a power of two.
+    explicit InternTable(std::size_t shardCount = defaultShardCount);
+
+    InternTable(const InternTable &) = delete;
+    InternTable &operator=(const InternTable &) = delete;
+
+    /// Returns the canonical instance of an object, adding it to the table if no equal object is present.
+    /// @param object A Core Foundation object or null.
+    /// @return The canonical instance, or null if `object` is null or on failure.
+    [[nodiscard]] CFRef<T> intern(T _Nullable object);
+
+    /// Returns the canonical instance of an object without adding it to the table.
+    /// @param object A Core Foundation object or null.
+    /// @return The canonical instance, or null if no equal object is present.
+    [[nodiscard]] CFRef<T> find(T _Nullable object) const;
+
+    /// Removes canonical instances referenced only by the table.
+    ///
+    /// An instance is removed if its retain count shows that no reference obtained from the table, or from
+    /// anywhere else, is outstanding. Each shard is locked while it is examined.
+    /// @return The number of instances removed.
+    std::size_t evictUnused() noexcept;
+
+    /// Removes all canonical instances.
+    void clear() noexcept;
+
+    /// Returns the number of canonical instances in the table.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+  private:
+    /// A set of canonical instances keyed by hash, protected by a lock.
+    struct alignas(64) Shard {
+        /// The lock protecting `entries`.
+        mutable std::mutex mutex;
+        /// The canonical instances keyed by hash; entries with equal hashes are distinguished using CFEqual.
+        std::unordered_multimap<CFHashCode, CFRef<T>> entries;
+    };
+
+    /// Returns the shard for a hash.
+    [[nodiscard]] Shard &shardFor(CFHashCode hash) const noexcept;
+
+    /// Returns an equal instance from a shard, or null; the shard must be locked.
+    [[nodiscard]] static T _Nullable lookup(const Shard &shard, CFHashCode hash, T _Nonnull object) noexcept;
+
+    /// Returns an immutable instance with the same content as `object`.
+    [[nodiscard]] static CFRef<T> canonicalize(T _Nonnull object);
+
+    /// The shards.
+    std::unique_ptr<Shard[]> shards_;
+    /// The number of shards minus one.
+    std::size_t mask_;
+};
+
+// MARK: - Implementation -
+
+template <typename T> inline InternTable<T>::InternTable(std::size_t shardCount) {
+    std::size_t count = 1;
+    while (count < shardCount) {
+        count <<= 1;
+    }
+    shards_ = std::make_unique<Shard[]>(count);
+    mask_ = count - 1;
+}
+
+template <typename T> inline CFRef<T> InternTable<T>::intern(T _Nullable object) {
+    if (object == nullptr) {
+        return {};
+    }
+
+    const auto hash = CFHash(object);
+    auto &shard = shardFor(hash);
+    {
+        std::lock_guard lock{shard.mutex};
+        if (auto existing = lookup(shard, hash, object); existing != nullptr) {
+            return CFRef<T>::retain(existing);
+        }
+    }
+
+    // Copy outside the lock; another thread may insert an equal instance in the meantime
+    auto canonical = canonicalize(object);
+    if (!canonical) {
+        return {};
+    }
+
+    std::lock_guard lock{shard.mutex};
+    if (auto existing = lookup(shard, hash, object); existing != nullptr) {
+        return CFRef<T>::retain(existing);
+    }
+    shard.entries.emplace(hash, canonical);
+    return canonical;
+}
+
+template <typename T> inline CFRef<T> InternTable<T>::find(T _Nullable object) const {
+    if (object == nullptr) {
+        return {};
+    }
+
+    const auto hash = CFHash(object);
+    auto &shard = shardFor(hash);
+    std::lock_guard lock{shard.mutex};
+    return CFRef<T>::retain(lookup(shard, hash, object));
+}
+
+template <typename T> inline std::size_t InternTable<T>::evictUnused() noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        auto &shard = shards_[i];
+        std::lock_guard lock{shard.mutex};
+        // References are only handed out under the lock, so a count of one cannot be raised concurrently
+        for (auto it = shard.entries.begin(); it != shard.entries.end();) {
+            if (CFGetRetainCount(it->second) == 1) {
+                it = shard.entries.erase(it);
+                ++count;
+            } else {
+                ++it;
+            }
+        }
+    }
+    return count;
+}
+
+template <typename T> inline void InternTable<T>::clear() noexcept {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        auto &shard = shards_[i];
+        std::lock_guard lock{shard.mutex};
+        shard.entries.clear();
+    }
+}
+
+template <typename T> inline std::size_t InternTable<T>::size() const noexcept {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        const auto &shard = shards_[i];
+        std::lock_guard lock{shard.mutex};
+        count += shard.entries.size();
+    }
+    return count;
+}
+
+template <typename T> inline typename InternTable<T>::Shard &InternTable<T>::shardFor(CFHashCode hash) const noexcept {
+    // Fold the high bits in so shard selection does not depend only on the bits the buckets also use
+    const auto mixed = static_cast<std::size_t>(hash ^ (hash >> 16));
+    return shards_[mixed & mask_];
+}
+
+template <typename T>
+inline T _Nullable InternTable<T>::lookup(const Shard &shard, CFHashCode hash, T _Nonnull object) noexcept {
+    const auto [first, last] = shard.entries.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        if (it->second.get() == object || CFEqual(it->second, object)) {
+            return it->second.get();
+        }
+    }
+    return nullptr;
+}
+
+template <typename T> inline CFRef<T> InternTable<T>::canonicalize(T _Nonnull object) {
+    // The copy functions return the object itself, retained, when it is already immutable
+    if constexpr (std::is_same_v<T, CFStringRef>) {
+        return CFString::adopt(CFStringCreateCopy(kCFAllocatorDefault, object));
+    } else if constexpr (std::is_same_v<T, CFDataRef>) {
+        return CFData::adopt(CFDataCreateCopy(kCFAllocatorDefault, object));
+    } else {
+        return CFRef<T>::retain(object);
+    }
+}
+
+} /* namespace cf */
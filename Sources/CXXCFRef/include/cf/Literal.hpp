@@ -0,0 +1,76 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <cassert>
+#include <cstddef>
+
+/// Expands to a constant CFStringRef for a string literal.
+///
+/// The string is a compile-time constant that is never deallocated, so it can be used directly as a dictionary key
+/// or argument without creating or retaining anything. Available in every language mode; in C++20 `cf::literal`
+/// also accepts strings as template arguments.
+#define CXXCFREF_LITERAL(string) CFSTR(string)
+
+#if __cpp_nontype_template_args >= 201911L
+
+namespace cf {
+
+namespace detail {
+
+/// A string usable as a template argument.
+template <std::size_t N> struct fixed_string {
+    /// The characters, including the terminating null character.
+    char value[N]{};
+
+    constexpr fixed_string(const char (&string)[N]) noexcept {
+        for (std::size_t i = 0; i < N; ++i) {
+            value[i] = string[i];
+        }
+    }
+
+    /// Returns the number of characters, excluding the terminating null character.
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return N - 1; }
+};
+
+} /* namespace detail */
+
+/// A process-lifetime CFString with the UTF-8 contents `S`.
+///
+/// The string is created on first use without copying its contents and is never released. It converts implicitly to
+/// CFStringRef and should be used directly rather than wrapped in a CFRef.
+template <detail::fixed_string S> struct literal_t final {
+    /// Returns the string.
+    [[nodiscard, clang::cf_returns_not_retained]] static CFStringRef _Nonnull get() noexcept;
+
+    /// Returns the string.
+    [[nodiscard, clang::cf_returns_not_retained]] operator CFStringRef _Nonnull() const noexcept { return get(); }
+};
+
+/// A process-lifetime CFString with the UTF-8 contents `S`.
+///
+/// For example, `CFDictionaryGetValue(dictionary, cf::literal<"key">)` performs no allocation and no reference counting
+/// after the first use.
+template <detail::fixed_string S> inline constexpr literal_t<S> literal{};
+
+// MARK: - Implementation -
+
+template <detail::fixed_string S> inline CFStringRef _Nonnull literal_t<S>::get() noexcept {
+    // The template parameter object has static storage duration, so its characters outlive the string
+    static const CFStringRef string = CFStringCreateWithBytesNoCopy(
+            kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(S.value), static_cast<CFIndex>(S.size()),
+            kCFStringEncodingUTF8, false, kCFAllocatorNull);
+    assert(string != nullptr && "cf::literal requires valid UTF-8");
+    return string;
+}
+
+} /* namespace cf */
+
+#endif /* __cpp_nontype_template_args >= 201911L */
@@ -0,0 +1,60 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include "CFRefCore.hpp"
+#include "CFRefMisc.hpp"
+
+namespace cf {
+
+/// Options controlling how a file is mapped by `mapped_data`.
+enum class MapOptions : unsigned {
+    /// Map the file read-only.
+    none = 0,
+    /// Advise the kernel that the bytes will be read sequentially (`MADV_SEQUENTIAL`).
+    sequential = 1u << 0,
+    /// Advise the kernel that the bytes will be needed soon (`MADV_WILLNEED`).
+    willNeed = 1u << 1,
+    /// Map the file copy-on-write instead of read-only.
+    ///
+    /// The bytes may then be modified in place; modifications are private to the process and never written to the
+    /// file.
+    copyOnWrite = 1u << 2,
+};
+
+[[nodiscard]] constexpr MapOptions operator|(MapOptions lhs, MapOptions rhs) noexcept {
+    return static_cast<MapOptions>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+[[nodiscard]] constexpr MapOptions operator&(MapOptions lhs, MapOptions rhs) noexcept {
+    return static_cast<MapOptions>(static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs));
+}
+
+/// Creates a CFData whose bytes are the memory-mapped contents of a file.
+///
+/// The file is unmapped when the CFData is deallocated. The file should not be truncated while it is mapped.
+/// @param path The file system path of the file.
+/// @param options Options controlling how the file is mapped.
+/// @param error An optional pointer to a CFError that receives a POSIX-domain error on failure.
+/// The caller is responsible for releasing the error.
+/// @return A CFData containing the contents of the file, or null on failure.
+[[nodiscard]] CFData mapped_data(const char *_Nonnull path, MapOptions options = MapOptions::none,
+                                 CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+/// Creates a CFData whose bytes are the memory-mapped contents of a file.
+///
+/// The file is unmapped when the CFData is deallocated. The file should not be truncated while it is mapped.
+/// @param url The file URL of the file.
+/// @param options Options controlling how the file is mapped.
+/// @param error An optional pointer to a CFError that receives a POSIX-domain error on failure.
+/// The caller is responsible for releasing the error.
+/// @return A CFData containing the contents of the file, or null on failure.
+[[nodiscard]] CFData mapped_data(CFURLRef _Nonnull url, MapOptions options = MapOptions::none,
+                                 CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+} /* namespace cf */
@@ -0,0 +1,441 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// Core Foundation collection callbacks storing values of the C++ type `V`.
+///
+/// Trivially copyable, default constructible values no larger than a pointer are stored in the collection's value
+/// slots directly and need no retain or release callbacks. Other values are copied to the heap when a collection
+/// retains them and destroyed when it releases them. Equality, hashing, and ordering map to `==`, `std::hash<V>`,
+/// and `<` where `V` supports them. The callbacks are invoked from C and are `noexcept`, so if copying a value
+/// throws, including `std::bad_alloc` when the heap copy cannot be allocated, `std::terminate` is called.
+template <typename V> struct NativeCallBacks final {
+    /// True if values are stored in the value slots instead of on the heap.
+    static constexpr bool isInline = std::is_trivially_copyable_v<V> && std::is_default_constructible_v<V> &&
+                                     sizeof(V) <= sizeof(const void *);
+
+    /// The type returned when reading a value: `V` if values are stored inline, `const V &` otherwise.
+    using const_reference = std::conditional_t<isInline, V, const V &>;
+
+    /// Returns the representation of a value passed to a Core Foundation collection function.
+    ///
+    /// Inline values are encoded as pointer bits. Other values are passed by address and copied by the retain
+    /// callback, so the result must not outlive `value`.
+    [[nodiscard]] static const void *_Nullable encode(const V &value) noexcept;
+
+    /// Returns the value represented by a value stored in a Core Foundation collection.
+    [[nodiscard]] static const_reference decode(const void *_Nullable value) noexcept;
+
+    /// Callbacks for CFArray. `equal` is null unless `V` supports `==`.
+    static const CFArrayCallBacks array;
+
+    /// Key callbacks for CFDictionary. `V` must support `==` and `std::hash<V>`.
+    static const CFDictionaryKeyCallBacks dictionaryKey;
+
+    /// Value callbacks for CFDictionary. `equal` is null unless `V` supports `==`.
+    static const CFDictionaryValueCallBacks dictionaryValue;
+
+    /// Callbacks for CFBinaryHeap. `V` must support `<`.
+    static const CFBinaryHeapCallBacks binaryHeap;
+
+  private:
+    static const void *_Nullable retain(CFAllocatorRef _Nullable allocator, const void *_Nullable value) noexcept;
+    static void release(CFAllocatorRef _Nullable allocator, const void *_Nullable value) noexcept;
+    static Boolean equal(const void *_Nullable lhs, const void *_Nullable rhs) noexcept;
+    static CFHashCode hash(const void *_Nullable value) noexcept;
+    static CFComparisonResult compare(const void *_Nullable lhs, const void *_Nullable rhs, void *_Nullable) noexcept;
+
+    /// Returns `equal` if `V` supports `==`, or null otherwise.
+    static constexpr CFArrayEqualCallBack _Nullable equalIfSupported() noexcept;
+};
+
+/// A mutable CFArray of `V` values.
+///
+/// The array is created with `NativeCallBacks<V>` and may be passed to any function accepting a CFArray whose
+/// elements it does not interpret. The wrapper owns its array and is movable but not copyable.
+template <typename V> class NativeArray final {
+  public:
+    /// The type returned when reading an element.
+    using const_reference = typename NativeCallBacks<V>::const_reference;
+
+    /// Creates an empty array.
+    /// @param capacity The maximum number of elements, or zero for no limit.
+    explicit NativeArray(CFIndex capacity = 0) noexcept;
+
+    NativeArray(NativeArray &&other) noexcept = default;
+    NativeArray &operator=(NativeArray &&other) noexcept = default;
+
+    /// Returns true if the array was created.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the number of elements.
+    [[nodiscard]] CFIndex size() const noexcept;
+
+    /// Returns true if the array contains no elements.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns the element at `index`.
+    /// @param index An index less than `size()`.
+    [[nodiscard]] const_reference operator[](CFIndex index) const noexcept;
+
+    /// Appends a copy of a value.
+    /// @note The copy is made by the retain callback; if it throws, `std::terminate` is called.
+    void push_back(const V &value);
+
+    /// Replaces the element at `index` with a copy of a value.
+    /// @param index An index less than `size()`, or equal to it to append.
+    /// @note The copy is made by the retain callback; if it throws, `std::terminate` is called.
+    void set(CFIndex index, const V &value);
+
+    /// Removes all elements.
+    void clear() noexcept;
+
+    /// Returns the array.
+    [[nodiscard]] const CFMutableArray &array() const noexcept;
+
+  private:
+    /// The array.
+    CFMutableArray array_;
+};
+
+/// A mutable CFDictionary mapping `K` keys to `V` values.
+///
+/// The dictionary is created with `NativeCallBacks<K>` key callbacks and `NativeCallBacks<V>` value callbacks, so
+/// lookups hash and compare keys using `std::hash<K>` and `==` without boxing them. The wrapper owns its dictionary
+/// and is movable but not copyable.
+template <typename K, typename V> class NativeDictionary final {
+  public:
+    /// Creates an empty dictionary.
+    /// @param capacity The maximum number of pairs, or zero for no limit.
+    explicit NativeDictionary(CFIndex capacity = 0) noexcept;
+
+    NativeDictionary(NativeDictionary &&other) noexcept = default;
+    NativeDictionary &operator=(NativeDictionary &&other) noexcept = default;
+
+    /// Returns true if the dictionary was created.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the number of pairs.
+    [[nodiscard]] CFIndex size() const noexcept;
+
+    /// Returns true if the dictionary contains no pairs.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns true if the dictionary contains a key.
+    [[nodiscard]] bool contains(const K &key) const noexcept;
+
+    /// Returns a copy of the value for a key.
+    /// @return The value, or `std::nullopt` if the key is not present.
+    [[nodiscard]] std::optional<V> find(const K &key) const;
+
+    /// Sets the value for a key, replacing any existing value.
+    /// @note The copies are made by the retain callbacks; if either throws, `std::terminate` is called.
+    void set(const K &key, const V &value);
+
+    /// Removes a key and its value.
+    void erase(const K &key) noexcept;
+
+    /// Removes all pairs.
+    void clear() noexcept;
+
+    /// Returns the dictionary.
+    [[nodiscard]] const CFMutableDictionary &dictionary() const noexcept;
+
+  private:
+    /// The dictionary.
+    CFMutableDictionary dictionary_;
+};
+
+/// A CFBinaryHeap of `V` values ordered by `<`.
+///
+/// The smallest value is at the top of the heap. The wrapper owns its heap and is movable but not copyable.
+template <typename V> class NativeBinaryHeap final {
+  public:
+    /// The type returned when reading a value.
+    using const_reference = typename NativeCallBacks<V>::const_reference;
+
+    /// Creates an empty heap.
+    /// @param capacity The maximum number of values, or zero for no limit.
+    explicit NativeBinaryHeap(CFIndex capacity = 0) noexcept;
+
+    NativeBinaryHeap(NativeBinaryHeap &&other) noexcept = default;
+    NativeBinaryHeap &operator=(NativeBinaryHeap &&other) noexcept = default;
+
+    /// Returns true if the heap was created.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the number of values.
+    [[nodiscard]] CFIndex size() const noexcept;
+
+    /// Returns true if the heap contains no values.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns the smallest value.
+    /// @note The heap must not be empty.
+    [[nodiscard]] const_reference top() const noexcept;
+
+    /// Adds a copy of a value.
+    /// @note The copy is made by the retain callback; if it throws, `std::terminate` is called.
+    void push(const V &value);
+
+    /// Removes the smallest value.
+    /// @note The heap must not be empty.
+    void pop() noexcept;
+
+    /// Returns the heap.
+    [[nodiscard]] const CFBinaryHeap &heap() const noexcept;
+
+  private:
+    /// The heap.
+    CFBinaryHeap heap_;
+};
+
+namespace detail {
+
+/// Detects types supporting `==`.
+template <typename V, typename = void> struct is_equality_comparable : std::false_type {};
+
+template <typename V>
+struct is_equality_comparable<V, std::void_t<decltype(std::declval<const V &>() == std::declval<const V &>())>>
+    : std::true_type {};
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+// MARK: NativeCallBacks
+
+template <typename V> inline const void *_Nullable NativeCallBacks<V>::encode(const V &value) noexcept {
+    if constexpr (isInline) {
+        std::uintptr_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(V));
+        return reinterpret_cast<const void *>(bits);
+    } else {
+        return &value;
+    }
+}
+
+template <typename V>
+inline typename NativeCallBacks<V>::const_reference NativeCallBacks<V>::decode(const void *_Nullable value) noexcept {
+    if constexpr (isInline) {
+        const auto bits = reinterpret_cast<std::uintptr_t>(value);
+        V result;
+        std::memcpy(&result, &bits, sizeof(V));
+        return result;
+    } else {
+        return *static_cast<const V *>(value);
+    }
+}
+
+template <typename V>
+inline const void *_Nullable NativeCallBacks<V>::retain(CFAllocatorRef _Nullable /*allocator*/,
+                                                          const void *_Nullable value) noexcept {
+    return new V(decode(value));
+}
+
+template <typename V>
+inline void NativeCallBacks<V>::release(CFAllocatorRef _Nullable /*allocator*/, const void *_Nullable value) noexcept {
+    delete static_cast<const V *>(value);
+}
+
+template <typename V>
+inline Boolean NativeCallBacks<V>::equal(const void *_Nullable lhs, const void *_Nullable rhs) noexcept {
+    return decode(lhs) == decode(rhs);
+}
+
+template <typename V> inline CFHashCode NativeCallBacks<V>::hash(const void *_Nullable value) noexcept {
+    return static_cast<CFHashCode>(std::hash<V>{}(decode(value)));
+}
+
+template <typename V>
+inline CFComparisonResult NativeCallBacks<V>::compare(const void *_Nullable lhs, const void *_Nullable rhs,
+                                                      void *_Nullable /*info*/) noexcept {
+    const_reference l = decode(lhs);
+    const_reference r = decode(rhs);
+    if (l < r) {
+        return kCFCompareLessThan;
+    }
+    if (r < l) {
+        return kCFCompareGreaterThan;
+    }
+    return kCFCompareEqualTo;
+}
+
+template <typename V> constexpr CFArrayEqualCallBack _Nullable NativeCallBacks<V>::equalIfSupported() noexcept {
+    if constexpr (detail::is_equality_comparable<V>::value) {
+        return &NativeCallBacks::equal;
+    } else {
+        return nullptr;
+    }
+}
+
+// Members are only odr-used when the corresponding static is, so `V` need only support the operations its
+// collections require. Every initializer is a constant expression, so the tables are constant-initialized and are
+// complete before any dynamic initialization, including that of collections created by static initializers.
+
+template <typename V>
+inline const CFArrayCallBacks NativeCallBacks<V>::array = {
+        0,
+        isInline ? nullptr : &NativeCallBacks::retain,
+        isInline ? nullptr : &NativeCallBacks::release,
+        nullptr,
+        equalIfSupported(),
+};
+
+template <typename V>
+inline const CFDictionaryKeyCallBacks NativeCallBacks<V>::dictionaryKey = {
+        0,
+        isInline ? nullptr : &NativeCallBacks::retain,
+        isInline ? nullptr : &NativeCallBacks::release,
+        nullptr,
+        &NativeCallBacks::equal,
+        &NativeCallBacks::hash,
+};
+
+template <typename V>
+inline const CFDictionaryValueCallBacks NativeCallBacks<V>::dictionaryValue = {
+        0,
+        isInline ? nullptr : &NativeCallBacks::retain,
+        isInline ? nullptr : &NativeCallBacks::release,
+        nullptr,
+        equalIfSupported(),
+};
+
+template <typename V>
+inline const CFBinaryHeapCallBacks NativeCallBacks<V>::binaryHeap = {
+        0,
+        isInline ? nullptr : &NativeCallBacks::retain,
+        isInline ? nullptr : &NativeCallBacks::release,
+        nullptr,
+        &NativeCallBacks::compare,
+};
+
+// MARK: NativeArray
+
+template <typename V>
+inline NativeArray<V>::NativeArray(CFIndex capacity) noexcept
+    : array_{CFArrayCreateMutable(kCFAllocatorDefault, capacity, &NativeCallBacks<V>::array)} {}
+
+template <typename V> inline NativeArray<V>::operator bool() const noexcept { return static_cast<bool>(array_); }
+
+template <typename V> inline CFIndex NativeArray<V>::size() const noexcept { return CFArrayGetCount(array_); }
+
+template <typename V> inline bool NativeArray<V>::empty() const noexcept { return size() == 0; }
+
+template <typename V>
+inline typename NativeArray<V>::const_reference NativeArray<V>::operator[](CFIndex index) const noexcept {
+    assert(index >= 0 && index < size());
+    return NativeCallBacks<V>::decode(CFArrayGetValueAtIndex(array_, index));
+}
+
+template <typename V> inline void NativeArray<V>::push_back(const V &value) {
+    CFArrayAppendValue(array_, NativeCallBacks<V>::encode(value));
+}
+
+template <typename V> inline void NativeArray<V>::set(CFIndex index, const V &value) {
+    assert(index >= 0 && index <= size());
+    CFArraySetValueAtIndex(array_, index, NativeCallBacks<V>::encode(value));
+}
+
+template <typename V> inline void NativeArray<V>::clear() noexcept { CFArrayRemoveAllValues(array_); }
+
+template <typename V> inline const CFMutableArray &NativeArray<V>::array() const noexcept { return array_; }
+
+// MARK: NativeDictionary
+
+template <typename K, typename V>
+inline NativeDictionary<K, V>::NativeDictionary(CFIndex capacity) noexcept
+    : dictionary_{CFDictionaryCreateMutable(kCFAllocatorDefault, capacity, &NativeCallBacks<K>::dictionaryKey,
+                                            &NativeCallBacks<V>::dictionaryValue)} {}
+
+template <typename K, typename V> inline NativeDictionary<K, V>::operator bool() const noexcept {
+    return static_cast<bool>(dictionary_);
+}
+
+template <typename K, typename V> inline CFIndex NativeDictionary<K, V>::size() const noexcept {
+    return CFDictionaryGetCount(dictionary_);
+}
+
+template <typename K, typename V> inline bool NativeDictionary<K, V>::empty() const noexcept { return size() == 0; }
+
+template <typename K, typename V> inline bool NativeDictionary<K, V>::contains(const K &key) const noexcept {
+    return CFDictionaryContainsKey(dictionary_, NativeCallBacks<K>::encode(key));
+}
+
+template <typename K, typename V> inline std::optional<V> NativeDictionary<K, V>::find(const K &key) const {
+    // Inline values may legitimately be encoded as null, so presence is reported separately
+    const void *value = nullptr;
+    if (!CFDictionaryGetValueIfPresent(dictionary_, NativeCallBacks<K>::encode(key), &value)) {
+        return std::nullopt;
+    }
+    return NativeCallBacks<V>::decode(value);
+}
+
+template <typename K, typename V> inline void NativeDictionary<K, V>::set(const K &key, const V &value) {
+    CFDictionarySetValue(dictionary_, NativeCallBacks<K>::encode(key), NativeCallBacks<V>::encode(value));
+}
+
+template <typename K, typename V> inline void NativeDictionary<K, V>::erase(const K &key) noexcept {
+    CFDictionaryRemoveValue(dictionary_, NativeCallBacks<K>::encode(key));
+}
+
+template <typename K, typename V> inline void NativeDictionary<K, V>::clear() noexcept {
+    CFDictionaryRemoveAllValues(dictionary_);
+}
+
+template <typename K, typename V>
+inline const CFMutableDictionary &NativeDictionary<K, V>::dictionary() const noexcept {
+    return dictionary_;
+}
+
+// MARK: NativeBinaryHeap
+
+template <typename V>
+inline NativeBinaryHeap<V>::NativeBinaryHeap(CFIndex capacity) noexcept
+    : heap_{CFBinaryHeapCreate(kCFAllocatorDefault, capacity, &NativeCallBacks<V>::binaryHeap, nullptr)} {}
+
+template <typename V> inline NativeBinaryHeap<V>::operator bool() const noexcept { return static_cast<bool>(heap_); }
+
+template <typename V> inline CFIndex NativeBinaryHeap<V>::size() const noexcept {
+    return CFBinaryHeapGetCount(heap_);
+}
+
+template <typename V> inline bool NativeBinaryHeap<V>::empty() const noexcept { return size() == 0; }
+
+template <typename V>
+inline typename NativeBinaryHeap<V>::const_reference NativeBinaryHeap<V>::top() const noexcept {
+    assert(!empty());
+    return NativeCallBacks<V>::decode(CFBinaryHeapGetMinimum(heap_));
+}
+
+template <typename V> inline void NativeBinaryHeap<V>::push(const V &value) {
+    CFBinaryHeapAddValue(heap_, NativeCallBacks<V>::encode(value));
+}
+
+template <typename V> inline void NativeBinaryHeap<V>::pop() noexcept {
+    assert(!empty());
+    CFBinaryHeapRemoveMinimumValue(heap_);
+}
+
+template <typename V> inline const CFBinaryHeap &NativeBinaryHeap<V>::heap() const noexcept { return heap_; }
+
+} /* namespace cf */
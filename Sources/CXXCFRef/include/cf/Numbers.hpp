@@ -0,0 +1,136 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+
+namespace cf {
+
+/// Returns the CFNumberType that represents every value of the arithmetic type `T` exactly.
+///
+/// CFNumber has no unsigned types, so unsigned types map to the next larger signed type. `std::uint64_t` maps to
+/// `kCFNumberSInt64Type`, which cannot represent values greater than `INT64_MAX`.
+template <typename T> [[nodiscard]] constexpr CFNumberType number_type() noexcept;
+
+/// Returns the value of a CFNumber as a `T` if it can be represented exactly.
+///
+/// The value is read with CFNumberGetValue using the CFNumberType for `T`, without an intermediate conversion to
+/// double: an integer `T` rejects numbers with a fractional part or out of range, and a floating point `T` rejects
+/// numbers that would lose precision.
+/// @param number A CFNumber or null.
+/// @return The value, or `std::nullopt` if `number` is null or its value cannot be represented exactly as a `T`.
+template <typename T> [[nodiscard]] std::optional<T> number_cast(CFNumberRef _Nullable number) noexcept;
+
+/// Creates a CFNumber with the CFNumberType for `T`.
+///
+/// Integers in the range of the process-wide cache, and a few values common in audio metadata such as standard
+/// sample rates, are returned from the cache instead of being created. The cache is kept separately for each
+/// CFNumberType, so a cached number has the same type as a created one.
+/// @param value The value.
+/// @return A CFNumber, or null if `value` cannot be represented or on failure.
+template <typename T> [[nodiscard]] CFNumber make_number(T value) noexcept;
+
+/// The smallest integer held in the process-wide cache of CFNumbers.
+inline constexpr std::int64_t numberCacheMin = -128;
+
+/// The largest integer held in the dense part of the process-wide cache of CFNumbers.
+inline constexpr std::int64_t numberCacheMax = 1024;
+
+namespace detail {
+
+/// Returns the cached CFNumber of an integer CFNumberType for an integer without retaining it.
+///
+/// Cached numbers are created on first use and live for the rest of the process.
+/// @param value An integer representable by `type`.
+/// @param type One of `kCFNumberSInt8Type`, `kCFNumberSInt16Type`, `kCFNumberSInt32Type` or `kCFNumberSInt64Type`.
+/// @return The cached CFNumber, or null if `value` is not cached.
+[[nodiscard, clang::cf_returns_not_retained]] CFNumberRef _Nullable cachedNumber(std::int64_t value,
+                                                                                 CFNumberType type) noexcept;
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <typename T> constexpr CFNumberType number_type() noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "number_type requires a numeric type");
+    if constexpr (std::is_floating_point_v<T>) {
+        static_assert(sizeof(T) <= sizeof(double), "CFNumber does not support extended precision");
+        return sizeof(T) == sizeof(float) ? kCFNumberFloat32Type : kCFNumberFloat64Type;
+    } else if constexpr (std::is_signed_v<T>) {
+        return sizeof(T) == 1 ? kCFNumberSInt8Type
+               : sizeof(T) == 2 ? kCFNumberSInt16Type
+               : sizeof(T) == 4 ? kCFNumberSInt32Type
+                                : kCFNumberSInt64Type;
+    } else {
+        return sizeof(T) == 1 ? kCFNumberSInt16Type : sizeof(T) == 2 ? kCFNumberSInt32Type : kCFNumberSInt64Type;
+    }
+}
+
+template <typename T> inline std::optional<T> number_cast(CFNumberRef _Nullable number) noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "number_cast requires a numeric type");
+    if (number == nullptr) {
+        return std::nullopt;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        T value;
+        if (!CFNumberGetValue(number, number_type<T>(), &value)) {
+            return std::nullopt;
+        }
+        return value;
+    } else {
+        // CFNumberGetValue reports fractional and out of range values as lossy
+        std::int64_t value;
+        if (!CFNumberGetValue(number, kCFNumberSInt64Type, &value)) {
+            return std::nullopt;
+        }
+        if constexpr (std::is_signed_v<T>) {
+            if (value < static_cast<std::int64_t>(std::numeric_limits<T>::min()) ||
+                value > static_cast<std::int64_t>(std::numeric_limits<T>::max())) {
+                return std::nullopt;
+            }
+        } else {
+            if (value < 0 || static_cast<std::uint64_t>(value) > std::numeric_limits<T>::max()) {
+                return std::nullopt;
+            }
+        }
+        return static_cast<T>(value);
+    }
+}
+
+template <typename T> inline CFNumber make_number(T value) noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "make_number requires a numeric type");
+    if constexpr (std::is_integral_v<T>) {
+        if constexpr (std::is_unsigned_v<T> && sizeof(T) == sizeof(std::int64_t)) {
+            if (value > static_cast<T>(std::numeric_limits<std::int64_t>::max())) {
+                return {};
+            }
+        }
+        if (auto cached = detail::cachedNumber(static_cast<std::int64_t>(value), number_type<T>());
+            cached != nullptr) {
+            return CFNumber::retain(cached);
+        }
+        // Widen to the signed type named by number_type so the bytes passed match the CFNumberType
+        using Signed = std::conditional_t<
+                (number_type<T>() == kCFNumberSInt8Type), std::int8_t,
+                std::conditional_t<(number_type<T>() == kCFNumberSInt16Type), std::int16_t,
+                                   std::conditional_t<(number_type<T>() == kCFNumberSInt32Type), std::int32_t,
+                                                      std::int64_t>>>;
+        const auto widened = static_cast<Signed>(value);
+        return CFNumber::adopt(CFNumberCreate(kCFAllocatorDefault, number_type<T>(), &widened));
+    } else {
+        return CFNumber::adopt(CFNumberCreate(kCFAllocatorDefault, number_type<T>(), &value));
+    }
+}
+
+} /* namespace cf */
@@ -0,0 +1,213 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+#include "SmallBuffer.hpp"
+
+namespace cf {
+
+/// Calls a function for every element of a CFArray, processing chunks of elements concurrently.
+///
+/// The array is retained once for the duration of the call and its elements are fetched with a single call to
+/// CFArrayGetValues; elements are not retained. Contiguous chunks of elements are processed concurrently using
+/// dispatch_apply, and the call returns once every element has been processed. If `f` throws, chunks not yet
+/// started are skipped and the first exception is rethrown.
+/// @tparam E The element type.
+/// @param array A CFArray or null. The array must not be mutated during the call.
+/// @param f A function invoked as `f(E)`. It may be called concurrently from multiple threads.
+template <typename E = CFTypeRef, typename F> void parallel_for_each(CFArrayRef _Nullable array, F &&f);
+
+/// Calls a function for every key-value pair of a CFDictionary, processing chunks of pairs concurrently.
+///
+/// The dictionary is retained once for the duration of the call and its pairs are fetched with a single call to
+/// CFDictionaryGetKeysAndValues. Otherwise it behaves like the CFArray overload.
+/// @tparam K The key type.
+/// @tparam V The value type.
+/// @param dictionary A CFDictionary or null. The dictionary must not be mutated during the call.
+/// @param f A function invoked as `f(K, V)`. It may be called concurrently from multiple threads.
+template <typename K = CFTypeRef, typename V = CFTypeRef, typename F>
+void parallel_for_each(CFDictionaryRef _Nullable dictionary, F &&f);
+
+/// Calls a function for every element of a CFSet, processing chunks of elements concurrently.
+///
+/// The set is retained once for the duration of the call and its elements are fetched with a single call to
+/// CFSetGetValues. Otherwise it behaves like the CFArray overload.
+/// @tparam E The element type.
+/// @param set A CFSet or null. The set must not be mutated during the call.
+/// @param f A function invoked as `f(E)`. It may be called concurrently from multiple threads.
+template <typename E = CFTypeRef, typename F> void parallel_for_each(CFSetRef _Nullable set, F &&f);
+
+/// Creates a CFArray containing the results of a function applied concurrently to every element of a CFArray.
+///
+/// Elements are processed as by `parallel_for_each`, and the results are collected in order into a CFArray created
+/// with a single call to CFArrayCreate.
+/// @tparam E The element type.
+/// @param array A CFArray or null. The array must not be mutated during the call.
+/// @param f A function invoked as `f(E)` returning a CFRef. It may be called concurrently from multiple threads.
+/// @return A CFArray of the results, or null if `f` returned null for any element or on failure.
+template <typename E = CFTypeRef, typename F>
+[[nodiscard]] CFArray parallel_transform(CFArrayRef _Nullable array, F &&f);
+
+namespace detail {
+
+/// Invokes `work` concurrently on consecutive chunks of the range `[0, count)` and waits for all chunks to finish.
+///
+/// Chunks are sized so that each processor receives several of them, and are never smaller than a minimum size
+/// that amortizes the cost of scheduling.
+/// @param count The number of elements.
+/// @param context A pointer passed to `work`.
+/// @param work A function invoked as `work(context, begin, end)` for each chunk.
+void apply_chunks(std::size_t count, void *_Nullable context,
+                  void (*_Nonnull work)(void *_Nullable context, std::size_t begin, std::size_t end)) noexcept;
+
+/// Invokes `body(begin, end)` concurrently on consecutive chunks of `[0, count)` and rethrows the first exception.
+template <typename Body> void parallel_chunks(std::size_t count, Body &body);
+
+/// The number of elements fetched from a collection without a heap allocation.
+inline constexpr std::size_t parallelInlineCapacity = 32;
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <typename Body> inline void detail::parallel_chunks(std::size_t count, Body &body) {
+    struct Context {
+        Body &body;
+        std::atomic<bool> failed{false};
+        std::exception_ptr exception{};
+    } context{body};
+
+    apply_chunks(count, &context, [](void *_Nullable ptr, std::size_t begin, std::size_t end) noexcept {
+        auto &context = *static_cast<Context *>(ptr);
+        if (context.failed.load(std::memory_order_relaxed)) {
+            return;
+        }
+        try {
+            context.body(begin, end);
+        } catch (...) {
+            if (!context.failed.exchange(true, std::memory_order_relaxed)) {
+                context.exception = std::current_exception();
+            }
+        }
+    });
+
+    if (context.exception) {
+        std::rethrow_exception(context.exception);
+    }
+}
+
+template <typename E, typename F> inline void parallel_for_each(CFArrayRef _Nullable array, F &&f) {
+    const auto retained = CFArray::retain(array);
+    if (!retained) {
+        return;
+    }
+
+    const auto count = CFArrayGetCount(retained);
+    detail::SmallBuffer<const void *, detail::parallelInlineCapacity> values(static_cast<std::size_t>(count));
+    CFArrayGetValues(retained, CFRangeMake(0, count), values.data());
+
+    auto body = [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            f(detail::element_cast<E>(values[i]));
+        }
+    };
+    detail::parallel_chunks(values.size(), body);
+}
+
+template <typename K, typename V, typename F>
+inline void parallel_for_each(CFDictionaryRef _Nullable dictionary, F &&f) {
+    const auto retained = CFDictionary::retain(dictionary);
+    if (!retained) {
+        return;
+    }
+
+    // Keys are stored in the first half of the buffer and values in the second
+    const auto count = static_cast<std::size_t>(CFDictionaryGetCount(retained));
+    detail::SmallBuffer<const void *, 2 * detail::parallelInlineCapacity> pairs(2 * count);
+    CFDictionaryGetKeysAndValues(retained, pairs.data(), pairs.data() + count);
+
+    auto body = [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            f(detail::element_cast<K>(pairs[i]), detail::element_cast<V>(pairs[count + i]));
+        }
+    };
+    detail::parallel_chunks(count, body);
+}
+
+template <typename E, typename F> inline void parallel_for_each(CFSetRef _Nullable set, F &&f) {
+    const auto retained = CFSet::retain(set);
+    if (!retained) {
+        return;
+    }
+
+    detail::SmallBuffer<const void *, detail::parallelInlineCapacity> values(
+            static_cast<std::size_t>(CFSetGetCount(retained)));
+    CFSetGetValues(retained, values.data());
+
+    auto body = [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            f(detail::element_cast<E>(values[i]));
+        }
+    };
+    detail::parallel_chunks(values.size(), body);
+}
+
+template <typename E, typename F> inline CFArray parallel_transform(CFArrayRef _Nullable array, F &&f) {
+    const auto retained = CFArray::retain(array);
+    if (!retained) {
+        return {};
+    }
+
+    const auto count = CFArrayGetCount(retained);
+    detail::SmallBuffer<const void *, detail::parallelInlineCapacity> values(static_cast<std::size_t>(count));
+    CFArrayGetValues(retained, CFRangeMake(0, count), values.data());
+
+    // Each chunk writes only its own slots, so the results need no synchronization
+    detail::SmallBuffer<const void *, detail::parallelInlineCapacity> results(values.size());
+    std::fill_n(results.data(), results.size(), nullptr);
+    struct Releaser {
+        detail::SmallBuffer<const void *, detail::parallelInlineCapacity> &results;
+        ~Releaser() {
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                if (results[i] != nullptr) {
+                    CFRelease(results[i]);
+                }
+            }
+        }
+    } releaser{results};
+
+    std::atomic<bool> missing{false};
+    auto body = [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            auto result = f(detail::element_cast<E>(values[i]));
+            if (!result) {
+                missing.store(true, std::memory_order_relaxed);
+            }
+            results[i] = result.leak();
+        }
+    };
+    detail::parallel_chunks(values.size(), body);
+
+    if (missing.load(std::memory_order_relaxed)) {
+        return {};
+    }
+    return CFArray::adopt(CFArrayCreate(kCFAllocatorDefault, results.data(), static_cast<CFIndex>(results.size()),
+                                        &kCFTypeArrayCallBacks));
+}
+
+} /* namespace cf */
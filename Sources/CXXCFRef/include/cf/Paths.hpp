@@ -0,0 +1,175 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+#include <limits.h>
+
+#include "Builders.hpp"
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFRefMisc.hpp"
+#include "CFTypeTraits.hpp"
+#include "SmallBuffer.hpp"
+
+namespace cf {
+
+/// Calls a function with the file system representation of a file URL.
+///
+/// The path is written by CFURLGetFileSystemRepresentation into a `PATH_MAX` buffer on the stack, so no CFString
+/// or `std::string` is created. Paths longer than `PATH_MAX` fall back to a heap buffer.
+/// @param url A file URL or null.
+/// @param f A function invoked as `f(std::string_view)` with the null-terminated path. The view is valid only for
+/// the duration of the call.
+/// @return true if `f` was invoked, false if `url` is null or has no file system representation.
+template <typename F> bool with_fs_path(CFURLRef _Nullable url, F &&f);
+
+/// Calls a function with the file system representation of every URL in a CFArray.
+///
+/// Elements are fetched in a single call to CFArrayGetValues and every path is written into the same stack buffer.
+/// @param urls A CFArray of file URLs, or null.
+/// @param f A function invoked as `f(std::size_t index, std::string_view path)` for each element with a file
+/// system representation. The view is valid only for the duration of the call.
+/// @return The number of elements for which `f` was invoked.
+template <typename F> std::size_t for_each_fs_path(CFArrayRef _Nullable urls, F &&f);
+
+/// Creates a file URL from a file system path using CFURLCreateFromFileSystemRepresentation.
+/// @param path A file system path, which need not be null-terminated.
+/// @param isDirectory Whether the path names a directory.
+/// @return A CFURL, or null on failure.
+[[nodiscard]] CFURL url_from_path(std::string_view path, bool isDirectory = false) noexcept;
+
+/// Creates a CFArray of file URLs from a range of file system paths.
+///
+/// Elements may be anything convertible to `std::string_view`. The URLs are collected into inline storage and the
+/// array is created with a single call to CFArrayCreate.
+/// @param paths A range of file system paths.
+/// @param isDirectory Whether the paths name directories.
+/// @return A CFArray of CFURLs, or null if any URL could not be created or on failure.
+template <typename Range> [[nodiscard]] CFArray urls_from_paths(const Range &paths, bool isDirectory = false);
+
+namespace detail {
+
+/// The size of the stack buffer used for file system paths.
+inline constexpr std::size_t pathBufferSize = PATH_MAX;
+
+/// Writes the file system representation of a file URL into a buffer, growing it if necessary.
+/// @return The length of the path, or -1 if the URL has no file system representation.
+[[nodiscard]] std::ptrdiff_t fs_path(CFURLRef _Nonnull url, SmallBuffer<char, pathBufferSize> &buffer);
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+inline std::ptrdiff_t detail::fs_path(CFURLRef _Nonnull url, SmallBuffer<char, pathBufferSize> &buffer) {
+    buffer.resize(pathBufferSize);
+    if (CFURLGetFileSystemRepresentation(url, true, reinterpret_cast<UInt8 *>(buffer.data()),
+                                         static_cast<CFIndex>(buffer.size()))) {
+        return static_cast<std::ptrdiff_t>(std::strlen(buffer.data()));
+    }
+
+    // The path is too long for the buffer or has no file system representation; only file URLs have one. The URL is
+    // made absolute first so that a relative URL is resolved against its base, as CFURLGetFileSystemRepresentation
+    // does above
+    const auto absolute = CFURL::adopt(CFURLCopyAbsoluteURL(url));
+    if (!absolute) {
+        return -1;
+    }
+    const auto scheme = CFString::adopt(CFURLCopyScheme(absolute));
+    if (!scheme || CFStringCompare(scheme, CFSTR("file"), kCFCompareCaseInsensitive) != kCFCompareEqualTo) {
+        return -1;
+    }
+    const auto path = CFString::adopt(CFURLCopyFileSystemPath(absolute, kCFURLPOSIXPathStyle));
+    if (!path) {
+        return -1;
+    }
+    buffer.resize(static_cast<std::size_t>(CFStringGetMaximumSizeOfFileSystemRepresentation(path)));
+    if (!CFStringGetFileSystemRepresentation(path, buffer.data(), static_cast<CFIndex>(buffer.size()))) {
+        return -1;
+    }
+    return static_cast<std::ptrdiff_t>(std::strlen(buffer.data()));
+}
+
+template <typename F> inline bool with_fs_path(CFURLRef _Nullable url, F &&f) {
+    if (url == nullptr) {
+        return false;
+    }
+    detail::SmallBuffer<char, detail::pathBufferSize> buffer;
+    const auto length = detail::fs_path(url, buffer);
+    if (length < 0) {
+        return false;
+    }
+    f(std::string_view{buffer.data(), static_cast<std::size_t>(length)});
+    return true;
+}
+
+template <typename F> inline std::size_t for_each_fs_path(CFArrayRef _Nullable urls, F &&f) {
+    if (urls == nullptr) {
+        return 0;
+    }
+
+    const auto count = CFArrayGetCount(urls);
+    detail::SmallBuffer<const void *, detail::builderInlineCapacity> values(static_cast<std::size_t>(count));
+    CFArrayGetValues(urls, CFRangeMake(0, count), values.data());
+
+    detail::SmallBuffer<char, detail::pathBufferSize> buffer;
+    std::size_t visited = 0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const auto length = detail::fs_path(detail::element_cast<CFURLRef>(values[i]), buffer);
+        if (length < 0) {
+            continue;
+        }
+        f(i, std::string_view{buffer.data(), static_cast<std::size_t>(length)});
+        ++visited;
+    }
+    return visited;
+}
+
+inline CFURL url_from_path(std::string_view path, bool isDirectory) noexcept {
+    return CFURL::adopt(CFURLCreateFromFileSystemRepresentation(
+            kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(path.data()), static_cast<CFIndex>(path.size()),
+            isDirectory));
+}
+
+template <typename Range> inline CFArray urls_from_paths(const Range &paths, bool isDirectory) {
+    detail::SmallBuffer<const void *, detail::builderInlineCapacity> values;
+    values.reserve(detail::size_hint(paths));
+
+    // Release the URLs created so far on every path; the array retains its own references
+    struct Releaser {
+        detail::SmallBuffer<const void *, detail::builderInlineCapacity> &values;
+        ~Releaser() {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                CFRelease(values[i]);
+            }
+        }
+    } releaser{values};
+
+    for (const auto &element : paths) {
+        const std::string_view path{element};
+        // Grow before creating the URL so that appending it cannot throw and leak it
+        if (values.size() == values.capacity()) {
+            values.reserve(values.capacity() * 2);
+        }
+        const auto url = CFURLCreateFromFileSystemRepresentation(
+                kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(path.data()), static_cast<CFIndex>(path.size()),
+                isDirectory);
+        if (url == nullptr) {
+            return {};
+        }
+        values.push_back(url);
+    }
+
+    return CFArray::adopt(CFArrayCreate(kCFAllocatorDefault, values.data(), static_cast<CFIndex>(values.size()),
+                                        &kCFTypeArrayCallBacks));
+}
+
+} /* namespace cf */
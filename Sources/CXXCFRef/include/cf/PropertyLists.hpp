@@ -0,0 +1,84 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CFPropertyList.h>
+
+#include "CFRefCore.hpp"
+#include "CFRefMisc.hpp"
+#include "CFRefStreams.hpp"
+
+namespace cf {
+
+/// The default number of bytes buffered between the encoder and the file descriptor by `write_property_list`.
+inline constexpr CFIndex defaultPropertyListChunkSize = 64 * 1024;
+
+/// Encodes a property list to a stream, using CFPropertyListWrite.
+///
+/// In the binary format encoded bytes are written to the stream as the encoder produces them instead of being
+/// accumulated in a CFData. Other formats, such as XML, are encoded completely in memory before being written.
+/// @param propertyList The property list.
+/// @param stream An open CFWriteStream.
+/// @param format The format to encode.
+/// @param error An optional pointer to a CFError that receives the error on failure.
+/// The caller is responsible for releasing the error.
+/// @return The number of bytes written, or zero on failure.
+[[nodiscard]] CFIndex write_property_list(CFPropertyListRef _Nonnull propertyList, CFWriteStreamRef _Nonnull stream,
+                                          CFPropertyListFormat format = kCFPropertyListBinaryFormat_v1_0,
+                                          CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+/// Encodes a property list to a file descriptor through a fixed-size buffer.
+///
+/// The encoder writes into a bound stream pair with a buffer of `chunkSize` bytes on a separate thread, blocking
+/// whenever the buffer is full, while the calling thread drains the pair to `fd` in chunks of the same size. In the
+/// binary format memory for encoded bytes is therefore proportional to `chunkSize` rather than to the size of the
+/// document. Other formats, such as XML, are encoded completely in memory by CFPropertyListWrite before any bytes
+/// reach the buffer, so only the binary format is bounded. `fd` may refer to a file, pipe, or socket; it is written
+/// from its current offset and is not closed.
+/// @param propertyList The property list.
+/// @param fd An open file descriptor.
+/// @param format The format to encode.
+/// @param chunkSize The number of bytes buffered between the encoder and `fd`.
+/// @param error An optional pointer to a CFError that receives the error on failure.
+/// The caller is responsible for releasing the error.
+/// @return The number of bytes written, or zero on failure. On failure some bytes may already have been written.
+[[nodiscard]] CFIndex write_property_list(CFPropertyListRef _Nonnull propertyList, int fd,
+                                          CFPropertyListFormat format = kCFPropertyListBinaryFormat_v1_0,
+                                          CFIndex chunkSize = defaultPropertyListChunkSize,
+                                          CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+/// Decodes a property list from a stream, using CFPropertyListCreateWithStream.
+///
+/// The stream is read to its end.
+/// @param stream An open CFReadStream.
+/// @param options The mutability options, such as `kCFPropertyListImmutable`.
+/// @param format An optional pointer that receives the format of the decoded property list.
+/// @param error An optional pointer to a CFError that receives the error on failure.
+/// The caller is responsible for releasing the error.
+/// @return The property list, or null on failure.
+[[nodiscard]] CFPropertyList read_property_list(CFReadStreamRef _Nonnull stream,
+                                                CFOptionFlags options = kCFPropertyListImmutable,
+                                                CFPropertyListFormat *_Nullable format = nullptr,
+                                                CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+/// Decodes a property list directly from the memory-mapped contents of a file.
+///
+/// The file is mapped using `mapped_data` and decoded in place, so its contents are never copied into a buffer.
+/// The mapping is released before returning.
+/// @param path The file system path of the file.
+/// @param options The mutability options, such as `kCFPropertyListImmutable`.
+/// @param format An optional pointer that receives the format of the decoded property list.
+/// @param error An optional pointer to a CFError that receives the error on failure.
+/// The caller is responsible for releasing the error.
+/// @return The property list, or null on failure.
+[[nodiscard]] CFPropertyList read_property_list(const char *_Nonnull path,
+                                                CFOptionFlags options = kCFPropertyListImmutable,
+                                                CFPropertyListFormat *_Nullable format = nullptr,
+                                                CFErrorRef _Nullable *_Nullable error = nullptr) noexcept;
+
+} /* namespace cf */
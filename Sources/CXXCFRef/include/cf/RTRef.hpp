@@ -0,0 +1,239 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+#include "DeferredRelease.hpp"
+
+namespace cf {
+
+/// An RAII wrapper providing shared ownership semantics for Core Foundation reference-counted types that never
+/// releases its managed object on the calling thread.
+///
+/// RTRef has the same interface as CFRef, but releases are handed to `DeferredRelease::shared()` so that objects are
+/// never deallocated on a real-time thread. `DeferredRelease::shared()` should be called once before an RTRef is
+/// released on a real-time thread. As with CFRef, objects of immortal types are neither retained nor enqueued.
+template <typename T> class CXXCFREF_TRIVIAL_ABI RTRef final {
+  public:
+    static_assert(std::is_pointer_v<T>, "RTRef only supports Core Foundation opaque objects");
+#if __has_feature(objc_arc)
+    static_assert(!std::is_convertible_v<T, id>, "Use ARC for Objective-C types");
+#endif
+
+    /// The managed Core Foundation object type.
+    using element_type = T;
+
+    // MARK: Factory Methods
+
+    /// Constructs and returns an RTRef for an owned object.
+    ///
+    /// The RTRef assumes responsibility for releasing the passed object.
+    /// @param object A Core Foundation object or null.
+    /// @return An RTRef object.
+    static RTRef adopt(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs and returns an RTRef for an unowned object.
+    ///
+    /// The RTRef retains the passed object using CFRetain and assumes responsibility for releasing it.
+    /// @param object A Core Foundation object or null.
+    /// @return An RTRef object.
+    static RTRef retain(T _Nullable object) noexcept;
+
+    // MARK: Construction and Destruction
+
+    /// Constructs an empty RTRef with a null managed object.
+    RTRef() noexcept = default;
+
+    /// Constructs an empty RTRef with a null managed object.
+    RTRef(std::nullptr_t) noexcept;
+
+    /// Constructs an RTRef with an owned object.
+    ///
+    /// The RTRef assumes responsibility for releasing the passed object.
+    /// @param object A Core Foundation object or null.
+    explicit RTRef(T _Nullable object [[clang::cf_consumed]]) noexcept;
+
+    /// Constructs an RTRef with an unowned object.
+    ///
+    /// The RTRef retains the passed object using CFRetain and assumes responsibility for releasing it.
+    /// @param object A Core Foundation object or null.
+    RTRef(T _Nullable object, retain_t /*unused*/) noexcept;
+
+    /// Constructs an RTRef sharing the managed object of a CFRef.
+    /// @param other A CFRef object.
+    explicit RTRef(const CFRef<T> &other) noexcept;
+
+    /// Constructs an RTRef by taking ownership of the managed object of a CFRef.
+    /// @param other A CFRef object.
+    explicit RTRef(CFRef<T> &&other) noexcept;
+
+    /// Constructs a copy of an existing RTRef.
+    /// @param other An RTRef object.
+    RTRef(const RTRef &other) noexcept;
+
+    /// Replaces the managed object with the managed object from another RTRef.
+    /// @param other An RTRef object.
+    /// @return A reference to this.
+    RTRef &operator=(const RTRef &other) noexcept;
+
+    /// Constructs an RTRef by moving an existing RTRef.
+    /// @param other An RTRef object.
+    RTRef(RTRef &&other) noexcept;
+
+    /// Replaces the managed object with the managed object from another RTRef.
+    /// @param other An RTRef object.
+    /// @return A reference to this.
+    RTRef &operator=(RTRef &&other) noexcept;
+
+    /// Destroys the RTRef and enqueues the managed object for release.
+    ~RTRef() noexcept;
+
+    // MARK: Core Foundation Object Management
+
+    /// Returns true if the managed object is not null.
+    [[nodiscard]] explicit operator bool() const noexcept;
+
+    /// Returns the managed object.
+    [[nodiscard, clang::cf_returns_not_retained]] operator T() const noexcept;
+
+    /// Returns true if the managed object is equal to the managed object from another RTRef.
+    ///
+    /// Objects are compared as by `CFRef::isEqual`.
+    /// @param other An RTRef object.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(const RTRef &other) const noexcept;
+
+    /// Returns true if the managed object is equal to a CFTypeRef.
+    ///
+    /// Objects are compared as by `CFRef::isEqual`.
+    /// @param other A Core Foundation object or null.
+    /// @return true if the objects are equal, false otherwise.
+    [[nodiscard]] bool isEqual(CFTypeRef _Nullable other) const noexcept;
+
+    /// Returns the managed object.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_not_retained]] T _Nullable get() const & noexcept;
+
+    /// Resets the managed object and returns a pointer to the internal storage.
+    ///
+    /// The RTRef will assume responsibility for releasing any object written to its storage.
+    /// @return A pointer to a null Core Foundation object.
+    [[nodiscard]] T _Nullable *_Nonnull put() & noexcept;
+
+    /// Replaces the managed object with another owned object and enqueues the previous object for release.
+    ///
+    /// The RTRef assumes responsibility for releasing the passed object.
+    /// @param object A Core Foundation object or null.
+    void reset(T _Nullable object [[clang::cf_consumed]] = nullptr) noexcept;
+
+    /// Swaps the managed object with the managed object from another RTRef.
+    /// @param other An RTRef object.
+    void swap(RTRef &other) noexcept;
+
+    /// Relinquishes ownership of the managed object and returns it.
+    ///
+    /// The caller assumes responsibility for releasing the returned object using CFRelease. Objects of immortal types
+    /// are never retained, so no reference is transferred for them and releasing one is unnecessary.
+    /// @return A Core Foundation object or null.
+    [[nodiscard, clang::cf_returns_retained]] T _Nullable leak() noexcept;
+
+    T _Nullable get() const && = delete;
+    T _Nullable *_Nonnull put() && = delete;
+
+  private:
+    /// The managed Core Foundation object.
+    T object_{nullptr};
+};
+
+// MARK: - Implementation -
+
+// MARK: Factory Methods
+
+template <typename T> inline auto RTRef<T>::adopt(T _Nullable object) noexcept -> RTRef { return RTRef(object); }
+
+template <typename T> inline auto RTRef<T>::retain(T _Nullable object) noexcept -> RTRef {
+    return RTRef(object, cf::retain);
+}
+
+// MARK: Construction and Destruction
+
+template <typename T> inline RTRef<T>::RTRef(std::nullptr_t) noexcept {}
+
+template <typename T> inline RTRef<T>::RTRef(T _Nullable object) noexcept : object_{object} {}
+
+template <typename T>
+inline RTRef<T>::RTRef(T _Nullable object, retain_t /*unused*/) noexcept : object_{detail::retain_object(object)} {}
+
+template <typename T> inline RTRef<T>::RTRef(const CFRef<T> &other) noexcept : RTRef(other.get(), cf::retain) {}
+
+template <typename T> inline RTRef<T>::RTRef(CFRef<T> &&other) noexcept : object_{other.leak()} {}
+
+template <typename T> inline RTRef<T>::RTRef(const RTRef &other) noexcept : RTRef(other.object_, cf::retain) {}
+
+template <typename T> inline auto RTRef<T>::operator=(const RTRef &other) noexcept -> RTRef & {
+    reset(detail::retain_object(other.object_));
+    return *this;
+}
+
+template <typename T> inline RTRef<T>::RTRef(RTRef &&other) noexcept : object_{other.leak()} {}
+
+template <typename T> inline auto RTRef<T>::operator=(RTRef &&other) noexcept -> RTRef & {
+    reset(other.leak());
+    return *this;
+}
+
+template <typename T> inline RTRef<T>::~RTRef() noexcept { reset(); }
+
+// MARK: Core Foundation Object Management
+
+template <typename T> inline RTRef<T>::operator bool() const noexcept { return object_ != nullptr; }
+
+template <typename T> inline RTRef<T>::operator T() const noexcept { return object_; }
+
+template <typename T> inline bool RTRef<T>::isEqual(const RTRef &other) const noexcept {
+    if (object_ == other.object_) {
+        return true;
+    }
+    return object_ != nullptr && other.object_ != nullptr && detail::comparator<T>::equal(object_, other.object_);
+}
+
+template <typename T> inline bool RTRef<T>::isEqual(CFTypeRef _Nullable other) const noexcept {
+    if (static_cast<CFTypeRef>(object_) == other) {
+        return true;
+    }
+    return object_ != nullptr && other != nullptr && detail::comparator<T>::equal(object_, other);
+}
+
+template <typename T> inline T _Nullable RTRef<T>::get() const & noexcept { return object_; }
+
+template <typename T> inline T _Nullable *_Nonnull RTRef<T>::put() & noexcept {
+    reset();
+    return &object_;
+}
+
+template <typename T> inline void RTRef<T>::reset(T _Nullable object) noexcept {
+    if constexpr (is_immortal_type_v<T>) {
+        object_ = object;
+    } else if (auto old = std::exchange(object_, object); old != nullptr) {
+        DeferredRelease::shared().release(static_cast<CFTypeRef>(old));
+    }
+}
+
+template <typename T> inline void RTRef<T>::swap(RTRef &other) noexcept { std::swap(object_, other.object_); }
+
+template <typename T> inline T _Nullable RTRef<T>::leak() noexcept { return std::exchange(object_, nullptr); }
+
+/// RTRef holds a single pointer and is trivially relocatable.
+template <typename T> struct is_trivially_relocatable<RTRef<T>> : std::true_type {};
+
+} /* namespace cf */
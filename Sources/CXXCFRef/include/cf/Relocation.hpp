@@ -0,0 +1,68 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// Applies `[[clang::trivial_abi]]` where supported so single-pointer wrappers are passed in registers.
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::trivial_abi)
+#define CXXCFREF_TRIVIAL_ABI [[clang::trivial_abi]]
+#endif
+#endif
+#ifndef CXXCFREF_TRIVIAL_ABI
+#define CXXCFREF_TRIVIAL_ABI
+#endif
+
+namespace cf {
+
+/// True if moving a `T` to a new address and ending the lifetime of the original is equivalent to copying its bytes.
+///
+/// Trivially copyable types are trivially relocatable. CFRef and its variants specialize this trait because they hold
+/// a single pointer and never refer to their own address.
+template <typename T> struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+/// True if `T` is trivially relocatable.
+template <typename T> inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/// Relocates the objects in `[first, last)` to uninitialized storage beginning at `destination`.
+///
+/// After the call the source objects have ended their lifetime and must not be destroyed. Trivially relocatable
+/// types are relocated using memcpy; other types are move-constructed and then destroyed.
+/// The source and destination ranges must not overlap.
+/// @param first The first object to relocate.
+/// @param last One past the last object to relocate.
+/// @param destination Uninitialized storage for `last - first` objects.
+/// @return One past the last relocated object in the destination.
+template <typename T> T *uninitialized_relocate(T *first, T *last, T *destination) noexcept;
+
+// MARK: - Implementation -
+
+template <typename T> inline T *uninitialized_relocate(T *first, T *last, T *destination) noexcept {
+    static_assert(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>,
+                  "uninitialized_relocate requires a trivially relocatable or nothrow move constructible type");
+    if constexpr (is_trivially_relocatable_v<T>) {
+        const auto count = static_cast<std::size_t>(last - first);
+        if (count != 0) {
+            std::memcpy(static_cast<void *>(destination), static_cast<const void *>(first), count * sizeof(T));
+        }
+        return destination + count;
+    } else {
+        for (; first != last; ++first, ++destination) {
+            ::new (static_cast<void *>(destination)) T(std::move(*first));
+            first->~T();
+        }
+        return destination;
+    }
+}
+
+} /* namespace cf */
@@ -0,0 +1,191 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace cf::detail {
+
+/// A resizable buffer of trivially copyable elements with inline storage for `N` elements.
+///
+/// Used as scratch space for bulk Core Foundation calls so that small inputs need no heap allocation.
+/// Elements added by `resize` are uninitialized.
+template <typename T, std::size_t N> class SmallBuffer final {
+  public:
+    static_assert(std::is_trivially_copyable_v<T>, "SmallBuffer only supports trivially copyable types");
+    static_assert(N > 0, "SmallBuffer requires inline storage");
+
+    /// Constructs an empty buffer.
+    SmallBuffer() noexcept = default;
+
+    /// Constructs a buffer of `size` uninitialized elements.
+    explicit SmallBuffer(std::size_t size);
+
+    SmallBuffer(const SmallBuffer &) = delete;
+    SmallBuffer &operator=(const SmallBuffer &) = delete;
+
+    /// Constructs a buffer by moving the contents of another buffer.
+    SmallBuffer(SmallBuffer &&other) noexcept;
+
+    /// Replaces the contents of the buffer with the contents of another buffer.
+    SmallBuffer &operator=(SmallBuffer &&other) noexcept;
+
+    ~SmallBuffer() noexcept = default;
+
+    /// Returns a pointer to the elements.
+    [[nodiscard]] T *data() noexcept;
+
+    /// Returns a pointer to the elements.
+    [[nodiscard]] const T *data() const noexcept;
+
+    /// Returns the number of elements.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Returns the number of elements that fit without reallocating.
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /// Returns true if the buffer contains no elements.
+    [[nodiscard]] bool empty() const noexcept;
+
+    [[nodiscard]] T &operator[](std::size_t index) noexcept;
+    [[nodiscard]] const T &operator[](std::size_t index) const noexcept;
+
+    /// Ensures the buffer can hold `capacity` elements without reallocating.
+    void reserve(std::size_t capacity);
+
+    /// Changes the number of elements; new elements are uninitialized.
+    void resize(std::size_t size);
+
+    /// Appends an element.
+    void push_back(const T &value);
+
+    /// Appends `count` elements.
+    void append(const T *values, std::size_t count);
+
+    /// Removes all elements without releasing storage.
+    void clear() noexcept;
+
+  private:
+    /// Reallocates storage for at least `capacity` elements.
+    void grow(std::size_t capacity);
+
+    /// The inline storage.
+    T inline_[N];
+    /// Heap storage, used when more than `N` elements are required.
+    std::unique_ptr<T[]> heap_;
+    /// The current storage.
+    T *data_{inline_};
+    /// The number of elements.
+    std::size_t size_{0};
+    /// The capacity of the current storage.
+    std::size_t capacity_{N};
+};
+
+// MARK: - Implementation -
+
+template <typename T, std::size_t N> inline SmallBuffer<T, N>::SmallBuffer(std::size_t size) { resize(size); }
+
+template <typename T, std::size_t N>
+inline SmallBuffer<T, N>::SmallBuffer(SmallBuffer &&other) noexcept
+    : heap_{std::move(other.heap_)}, size_{other.size_}, capacity_{other.capacity_} {
+    if (heap_) {
+        data_ = heap_.get();
+    } else {
+        std::memcpy(inline_, other.inline_, size_ * sizeof(T));
+    }
+    other.data_ = other.inline_;
+    other.size_ = 0;
+    other.capacity_ = N;
+}
+
+template <typename T, std::size_t N>
+inline auto SmallBuffer<T, N>::operator=(SmallBuffer &&other) noexcept -> SmallBuffer & {
+    if (this != &other) {
+        heap_ = std::move(other.heap_);
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        if (heap_) {
+            data_ = heap_.get();
+        } else {
+            data_ = inline_;
+            std::memcpy(inline_, other.inline_, size_ * sizeof(T));
+        }
+        other.data_ = other.inline_;
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N> inline T *SmallBuffer<T, N>::data() noexcept { return data_; }
+
+template <typename T, std::size_t N> inline const T *SmallBuffer<T, N>::data() const noexcept { return data_; }
+
+template <typename T, std::size_t N> inline std::size_t SmallBuffer<T, N>::size() const noexcept { return size_; }
+
+template <typename T, std::size_t N> inline std::size_t SmallBuffer<T, N>::capacity() const noexcept {
+    return capacity_;
+}
+
+template <typename T, std::size_t N> inline bool SmallBuffer<T, N>::empty() const noexcept { return size_ == 0; }
+
+template <typename T, std::size_t N> inline T &SmallBuffer<T, N>::operator[](std::size_t index) noexcept {
+    return data_[index];
+}
+
+template <typename T, std::size_t N>
+inline const T &SmallBuffer<T, N>::operator[](std::size_t index) const noexcept {
+    return data_[index];
+}
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::reserve(std::size_t capacity) {
+    if (capacity > capacity_) {
+        grow(capacity);
+    }
+}
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::resize(std::size_t size) {
+    reserve(size);
+    size_ = size;
+}
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::push_back(const T &value) {
+    if (size_ == capacity_) {
+        grow(capacity_ * 2);
+    }
+    data_[size_++] = value;
+}
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::append(const T *values, std::size_t count) {
+    if (count == 0) {
+        return;
+    }
+    if (size_ + count > capacity_) {
+        grow(std::max(size_ + count, capacity_ * 2));
+    }
+    std::memcpy(data_ + size_, values, count * sizeof(T));
+    size_ += count;
+}
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::clear() noexcept { size_ = 0; }
+
+template <typename T, std::size_t N> inline void SmallBuffer<T, N>::grow(std::size_t capacity) {
+    auto storage = std::unique_ptr<T[]>(new T[capacity]);
+    if (size_ != 0) {
+        std::memcpy(storage.get(), data_, size_ * sizeof(T));
+    }
+    heap_ = std::move(storage);
+    data_ = heap_.get();
+    capacity_ = capacity;
+}
+
+} /* namespace cf::detail */
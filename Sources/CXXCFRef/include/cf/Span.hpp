@@ -0,0 +1,102 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#if __has_include(<version>)
+#include <version>
+#endif
+
+#if __cpp_lib_span >= 202002L
+#include <span>
+#endif
+
+namespace cf {
+
+#if __cpp_lib_span >= 202002L
+
+/// A non-owning view of a contiguous sequence of `T`.
+template <typename T> using span = std::span<T>;
+
+#else
+
+/// A non-owning view of a contiguous sequence of `T`.
+///
+/// A minimal stand-in for `std::span<T>` with a dynamic extent, used when the standard library does not provide one.
+template <typename T> class span final {
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+
+    /// Constructs an empty span.
+    constexpr span() noexcept = default;
+
+    /// Constructs a span of `size` elements starting at `data`.
+    constexpr span(T *data, size_type size) noexcept : data_{data}, size_{size} {}
+
+    /// Constructs a span of the elements of an array.
+    template <std::size_t N> constexpr span(T (&array)[N]) noexcept : data_{array}, size_{N} {}
+
+    /// Constructs a span of the elements of a contiguous container such as `std::vector` or `std::string`.
+    template <typename C,
+              typename = std::enable_if_t<
+                      !std::is_same_v<std::remove_cv_t<std::remove_reference_t<C>>, span> &&
+                      std::is_convertible_v<decltype(std::data(std::declval<C &>())), T *>>,
+              typename = decltype(std::size(std::declval<C &>()))>
+    constexpr span(C &&container) noexcept : data_{std::data(container)}, size_{std::size(container)} {}
+
+    /// Constructs a span of const elements from a span of mutable elements.
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr span(const span<U> &other) noexcept : data_{other.data()}, size_{other.size()} {}
+
+    [[nodiscard]] constexpr T *data() const noexcept { return data_; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr T &operator[](size_type index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+    [[nodiscard]] constexpr T &front() const noexcept { return (*this)[0]; }
+    [[nodiscard]] constexpr T &back() const noexcept { return (*this)[size_ - 1]; }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr iterator end() const noexcept { return data_ + size_; }
+
+    [[nodiscard]] constexpr span first(size_type count) const noexcept {
+        assert(count <= size_);
+        return {data_, count};
+    }
+    [[nodiscard]] constexpr span last(size_type count) const noexcept {
+        assert(count <= size_);
+        return {data_ + size_ - count, count};
+    }
+    [[nodiscard]] constexpr span subspan(size_type offset, size_type count) const noexcept {
+        assert(offset <= size_ && count <= size_ - offset);
+        return {data_ + offset, count};
+    }
+
+  private:
+    /// The first element.
+    T *data_{nullptr};
+    /// The number of elements.
+    size_type size_{0};
+};
+
+#endif /* __cpp_lib_span */
+
+} /* namespace cf */
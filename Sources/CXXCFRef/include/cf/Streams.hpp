@@ -0,0 +1,251 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#include <coroutine>
+#endif
+
+#include "CFRefCore.hpp"
+#include "CFRefMisc.hpp"
+#include "CFRefStreams.hpp"
+#include "Span.hpp"
+
+/// Defined to 1 if C++20 coroutines are available and the stream awaitables are declared.
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__cpp_lib_coroutine)
+#define CXXCFREF_COROUTINES 1
+#else
+#define CXXCFREF_COROUTINES 0
+#endif
+
+namespace cf {
+
+/// The result of an asynchronous stream operation.
+struct StreamResult {
+    /// The bytes transferred.
+    ///
+    /// For reads into a caller-provided buffer this is the filled prefix of the buffer, and for writes the prefix of
+    /// the bytes that was written. For buffered reads it may instead view the stream's internal buffer, which remains
+    /// valid only until the next operation on the stream.
+    span<const std::uint8_t> bytes;
+    /// The error that ended the operation, or null on success.
+    CFError error;
+
+    /// Returns true if the operation succeeded.
+    [[nodiscard]] explicit operator bool() const noexcept { return !error; }
+
+    /// Returns true if the operation succeeded without transferring bytes because the stream is at its end.
+    [[nodiscard]] bool atEnd() const noexcept { return !error && bytes.size() == 0; }
+};
+
+// Asynchronous operations complete on the run loop or dispatch queue the stream is scheduled on, using
+// CFReadStreamScheduleWithRunLoop, CFReadStreamSetDispatchQueue, or their CFWriteStream counterparts. The stream
+// must be open, at most one operation may be pending on a stream at a time, and an operation must be started
+// on the thread or queue that delivers the stream's events, so no event is delivered before its client is
+// installed. An operation that can complete immediately does so before returning, without waiting for an event.
+// Operations use the stream's client callback, so a stream may not have another client while one is pending.
+
+/// Reads bytes from a stream into a buffer asynchronously and invokes a completion function with the result.
+/// @param stream An open CFReadStream scheduled on a run loop or dispatch queue.
+/// @param buffer The buffer to read into. It must remain valid until the completion function is invoked.
+/// @param completion A function invoked as `completion(StreamResult)`. It must not throw.
+template <typename F> void async_read(CFReadStreamRef _Nonnull stream, span<std::uint8_t> buffer, F &&completion);
+
+/// Reads bytes from a stream asynchronously, viewing the stream's internal buffer when possible.
+///
+/// If the stream exposes its internal buffer through CFReadStreamGetBuffer the result views it without copying;
+/// otherwise bytes are read into `fallback`.
+/// @param stream An open CFReadStream scheduled on a run loop or dispatch queue.
+/// @param fallback The buffer to read into if the stream has no accessible internal buffer. It must remain valid
+/// until the completion function is invoked.
+/// @param completion A function invoked as `completion(StreamResult)`. It must not throw.
+template <typename F>
+void async_read_buffered(CFReadStreamRef _Nonnull stream, span<std::uint8_t> fallback, F &&completion);
+
+/// Writes bytes to a stream asynchronously and invokes a completion function with the result.
+///
+/// Like CFWriteStreamWrite, the operation may write fewer bytes than requested. Writing to a stream that is closed or
+/// at its end fails with `EPIPE`.
+/// @param stream An open CFWriteStream scheduled on a run loop or dispatch queue.
+/// @param bytes The bytes to write. They must remain valid until the completion function is invoked.
+/// @param completion A function invoked as `completion(StreamResult)`. It must not throw.
+template <typename F>
+void async_write(CFWriteStreamRef _Nonnull stream, span<const std::uint8_t> bytes, F &&completion);
+
+namespace detail {
+
+/// The state of one asynchronous stream operation.
+///
+/// The operation may be moved until it is started, but not between `start()` and its completion, because its
+/// address is the stream's client context.
+struct StreamOperation {
+    /// The kinds of operation.
+    enum class Kind : unsigned char {
+        /// A read into `data`.
+        read,
+        /// A read from the stream's internal buffer, or into `data` if it is not accessible.
+        readBuffered,
+        /// A write from `data`.
+        write,
+    };
+
+    /// Constructs a read operation.
+    StreamOperation(Kind kind, CFReadStreamRef _Nonnull stream, span<std::uint8_t> buffer) noexcept;
+
+    /// Constructs a write operation.
+    StreamOperation(CFWriteStreamRef _Nonnull stream, span<const std::uint8_t> buffer) noexcept;
+
+    StreamOperation(StreamOperation &&other) noexcept = default;
+    StreamOperation &operator=(StreamOperation &&other) noexcept = default;
+
+    /// Starts the operation.
+    ///
+    /// If the operation completes immediately, `result` is set and `resume` is not invoked. Otherwise `resume` is
+    /// invoked with `result` set once the stream signals an event that completes it.
+    /// @return true if the operation completed immediately.
+    [[nodiscard]] bool start() noexcept;
+
+    /// The kind of operation.
+    Kind kind;
+    /// The stream for reads.
+    CFReadStream readStream;
+    /// The stream for writes.
+    CFWriteStream writeStream;
+    /// The bytes to read into or write.
+    std::uint8_t *_Nullable data;
+    /// The number of bytes to read or write.
+    CFIndex length;
+    /// The result of the operation.
+    StreamResult result;
+    /// The function invoked when the operation completes asynchronously.
+    void (*_Nullable resume)(StreamOperation &operation) noexcept{nullptr};
+    /// A pointer for use by `resume`.
+    void *_Nullable context{nullptr};
+};
+
+/// Starts an operation and invokes `completion` with its result.
+template <typename F> void start(StreamOperation &&operation, F &&completion);
+
+} /* namespace detail */
+
+#if CXXCFREF_COROUTINES
+
+/// An awaitable asynchronous stream operation.
+///
+/// Awaiting suspends the coroutine until the operation completes and yields a StreamResult. The coroutine is
+/// resumed on the run loop or dispatch queue the stream is scheduled on, or is not suspended at all if the
+/// operation completes immediately. The awaitable must be awaited exactly once.
+class StreamAwaitable final {
+  public:
+    /// Constructs an awaitable for an operation.
+    template <typename... Args> explicit StreamAwaitable(Args &&...args) noexcept;
+
+    StreamAwaitable(const StreamAwaitable &) = delete;
+    StreamAwaitable &operator=(const StreamAwaitable &) = delete;
+
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle) noexcept;
+    [[nodiscard]] StreamResult await_resume() noexcept { return std::move(operation_.result); }
+
+  private:
+    /// The operation.
+    detail::StreamOperation operation_;
+};
+
+/// Returns an awaitable that reads bytes from a stream into a buffer.
+/// @param stream An open CFReadStream scheduled on a run loop or dispatch queue.
+/// @param buffer The buffer to read into. It must remain valid until the awaiting coroutine resumes.
+/// @return An awaitable yielding a StreamResult.
+[[nodiscard]] StreamAwaitable async_read(CFReadStreamRef _Nonnull stream, span<std::uint8_t> buffer) noexcept;
+
+/// Returns an awaitable that reads bytes from a stream, viewing the stream's internal buffer when possible.
+/// @param stream An open CFReadStream scheduled on a run loop or dispatch queue.
+/// @param fallback The buffer to read into if the stream has no accessible internal buffer.
+/// @return An awaitable yielding a StreamResult.
+[[nodiscard]] StreamAwaitable async_read_buffered(CFReadStreamRef _Nonnull stream,
+                                                  span<std::uint8_t> fallback) noexcept;
+
+/// Returns an awaitable that writes bytes to a stream.
+/// @param stream An open CFWriteStream scheduled on a run loop or dispatch queue.
+/// @param bytes The bytes to write. They must remain valid until the awaiting coroutine resumes.
+/// @return An awaitable yielding a StreamResult.
+[[nodiscard]] StreamAwaitable async_write(CFWriteStreamRef _Nonnull stream, span<const std::uint8_t> bytes) noexcept;
+
+#endif /* CXXCFREF_COROUTINES */
+
+// MARK: - Implementation -
+
+template <typename F> inline void detail::start(StreamOperation &&operation, F &&completion) {
+    struct Pending {
+        StreamOperation operation;
+        std::decay_t<F> completion;
+    };
+
+    auto pending = std::unique_ptr<Pending>(new Pending{std::move(operation), std::forward<F>(completion)});
+    pending->operation.context = pending.get();
+    pending->operation.resume = [](StreamOperation &operation) noexcept {
+        const std::unique_ptr<Pending> pending{static_cast<Pending *>(operation.context)};
+        pending->completion(std::move(pending->operation.result));
+    };
+
+    if (pending->operation.start()) {
+        pending->completion(std::move(pending->operation.result));
+        return;
+    }
+    // Ownership passes to the stream's client callback
+    static_cast<void>(pending.release());
+}
+
+template <typename F>
+inline void async_read(CFReadStreamRef _Nonnull stream, span<std::uint8_t> buffer, F &&completion) {
+    detail::start({detail::StreamOperation::Kind::read, stream, buffer}, std::forward<F>(completion));
+}
+
+template <typename F>
+inline void async_read_buffered(CFReadStreamRef _Nonnull stream, span<std::uint8_t> fallback, F &&completion) {
+    detail::start({detail::StreamOperation::Kind::readBuffered, stream, fallback}, std::forward<F>(completion));
+}
+
+template <typename F>
+inline void async_write(CFWriteStreamRef _Nonnull stream, span<const std::uint8_t> bytes, F &&completion) {
+    detail::start({stream, bytes}, std::forward<F>(completion));
+}
+
+#if CXXCFREF_COROUTINES
+
+template <typename... Args>
+inline StreamAwaitable::StreamAwaitable(Args &&...args) noexcept : operation_{std::forward<Args>(args)...} {}
+
+inline bool StreamAwaitable::await_suspend(std::coroutine_handle<> handle) noexcept {
+    operation_.context = handle.address();
+    operation_.resume = [](detail::StreamOperation &operation) noexcept {
+        std::coroutine_handle<>::from_address(operation.context).resume();
+    };
+    return !operation_.start();
+}
+
+inline StreamAwaitable async_read(CFReadStreamRef _Nonnull stream, span<std::uint8_t> buffer) noexcept {
+    return StreamAwaitable{detail::StreamOperation::Kind::read, stream, buffer};
+}
+
+inline StreamAwaitable async_read_buffered(CFReadStreamRef _Nonnull stream, span<std::uint8_t> fallback) noexcept {
+    return StreamAwaitable{detail::StreamOperation::Kind::readBuffered, stream, fallback};
+}
+
+inline StreamAwaitable async_write(CFWriteStreamRef _Nonnull stream, span<const std::uint8_t> bytes) noexcept {
+    return StreamAwaitable{stream, bytes};
+}
+
+#endif /* CXXCFREF_COROUTINES */
+
+} /* namespace cf */
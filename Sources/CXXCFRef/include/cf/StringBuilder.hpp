@@ -0,0 +1,362 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include "CFRefCore.hpp"
+#include "Literal.hpp"
+#include "SmallBuffer.hpp"
+#include "StringView.hpp"
+
+namespace cf {
+
+/// Builds a CFString from pieces with a single string allocation.
+///
+/// Pieces are encoded as UTF-8 into inline storage for `N` bytes, or into a single heap buffer that grows
+/// geometrically for longer strings. `build()` then creates the CFString with one call to CFStringCreateWithBytes,
+/// unlike CFStringCreateWithFormat, which parses its format string on every call, or repeated CFStringAppend, which
+/// reallocates as the string grows.
+template <std::size_t N = 256> class StringBuilder final {
+  public:
+    /// Constructs an empty StringBuilder.
+    StringBuilder() noexcept = default;
+
+    StringBuilder(const StringBuilder &) = delete;
+    StringBuilder &operator=(const StringBuilder &) = delete;
+
+    StringBuilder(StringBuilder &&other) noexcept = default;
+    StringBuilder &operator=(StringBuilder &&other) noexcept = default;
+
+    /// Appends UTF-8 text.
+    StringBuilder &append(std::string_view string);
+
+    /// Appends null-terminated UTF-8 text.
+    StringBuilder &append(const char *_Nonnull string);
+
+    /// Appends UTF-16 text, converting it to UTF-8. Unpaired surrogates are replaced with U+FFFD.
+    StringBuilder &append(std::u16string_view string);
+
+    /// Appends null-terminated UTF-16 text, converting it to UTF-8.
+    StringBuilder &append(const char16_t *_Nonnull string);
+
+    /// Appends the contents of a CFString.
+    ///
+    /// Contents stored as ASCII are copied directly from the string's storage; otherwise they are converted by
+    /// CFStringGetBytes straight into the buffer. A string containing an unpaired surrogate, which CFStringGetBytes
+    /// cannot convert, is appended as UTF-16 instead, replacing the surrogate with U+FFFD.
+    /// @param string A CFString or null, which appends nothing.
+    StringBuilder &append(CFStringRef _Nullable string);
+
+    /// Appends a character.
+    StringBuilder &append(char c);
+
+    /// Appends `true` or `false`.
+    ///
+    /// This is a template so that pointers, which would otherwise convert to `bool`, never select it.
+    template <typename T, std::enable_if_t<std::is_same_v<T, bool>, int> = 0> StringBuilder &append(T value);
+
+    /// Appends the decimal representation of an integer, formatted by `std::to_chars`.
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+                                                   !std::is_same_v<T, char>,
+                                           int> = 0>
+    StringBuilder &append(T value);
+
+    /// Appends a representation of a floating-point value that round-trips. This is the shortest such representation
+    /// if the standard library supports `std::to_chars` for floating-point types; otherwise `snprintf` is used.
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0> StringBuilder &append(T value);
+
+    /// Appends a value using the matching overload of `append`.
+    template <typename T> StringBuilder &operator<<(const T &value);
+
+    /// Reserves space for at least `capacity` bytes of UTF-8.
+    void reserve(std::size_t capacity);
+
+    /// Returns the number of bytes of UTF-8 appended.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Returns true if nothing has been appended.
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Returns the UTF-8 contents. The view is valid until the builder is modified or destroyed.
+    [[nodiscard]] std::string_view view() const noexcept;
+
+    /// Removes the contents, keeping the storage.
+    void clear() noexcept;
+
+    /// Creates a CFString with the contents.
+    /// @return A CFString, or null if the contents are not valid UTF-8 or on failure.
+    [[nodiscard]] CFString build() const noexcept;
+
+  private:
+    /// Ensures space for `count` more bytes and returns a pointer to the end of the contents.
+    [[nodiscard]] char *_Nonnull prepare(std::size_t count);
+
+    /// Marks `count` bytes written after `prepare` as part of the contents.
+    void commit(std::size_t count) noexcept;
+
+    /// The UTF-8 contents.
+    detail::SmallBuffer<char, N> buffer_;
+};
+
+/// Creates a CFString by concatenating values with a StringBuilder.
+///
+/// For example, `cf::concat("track-", index, '.', extension)` creates its result with a single string allocation.
+/// @param values Values accepted by `StringBuilder::append`.
+/// @return A CFString, or null on failure.
+template <typename... Args> [[nodiscard]] CFString concat(const Args &...values);
+
+#if __cpp_nontype_template_args >= 201911L
+
+/// Creates a CFString by substituting values for the `{}` placeholders in a format string.
+///
+/// The format string is parsed at compile time, and a mismatch between the number of placeholders and values, or
+/// an unmatched brace, is a compile-time error. Each placeholder is replaced using `StringBuilder::append`; `{{`
+/// and `}}` produce literal braces. For example, `cf::format<"{}:{}">(host, port)`.
+/// @param values Values accepted by `StringBuilder::append`, one per placeholder.
+/// @return A CFString, or null on failure.
+template <detail::fixed_string Format, typename... Args> [[nodiscard]] CFString format(const Args &...values);
+
+#endif /* __cpp_nontype_template_args >= 201911L */
+
+namespace detail {
+
+/// Returns the number of `{}` placeholders in a format string, or -1 if it contains an unmatched brace.
+[[nodiscard]] constexpr std::ptrdiff_t count_placeholders(std::string_view format) noexcept;
+
+/// Appends the literal text of a format string from `position` to its next placeholder or its end.
+/// @return The position following the placeholder, or the length of the format string.
+template <std::size_t N>
+std::size_t append_format_text(StringBuilder<N> &builder, std::string_view format, std::size_t position);
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <std::size_t N> inline char *_Nonnull StringBuilder<N>::prepare(std::size_t count) {
+    const auto required = buffer_.size() + count;
+    if (required > buffer_.capacity()) {
+        buffer_.reserve(std::max(required, buffer_.capacity() * 2));
+    }
+    return buffer_.data() + buffer_.size();
+}
+
+template <std::size_t N> inline void StringBuilder<N>::commit(std::size_t count) noexcept {
+    // The space was reserved by prepare, so this never reallocates
+    buffer_.resize(buffer_.size() + count);
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(std::string_view string) {
+    buffer_.append(string.data(), string.size());
+    return *this;
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(const char *_Nonnull string) {
+    return append(std::string_view{string});
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(std::u16string_view string) {
+    // Each UTF-16 code unit produces at most three bytes of UTF-8
+    auto *const begin = prepare(string.size() * 3);
+    auto *out = begin;
+    for (std::size_t i = 0; i < string.size(); ++i) {
+        char32_t c = string[i];
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            if (c <= 0xDBFF && i + 1 < string.size() && string[i + 1] >= 0xDC00 && string[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (string[++i] - 0xDC00);
+            } else {
+                c = 0xFFFD;
+            }
+        }
+        if (c < 0x80) {
+            *out++ = static_cast<char>(c);
+        } else if (c < 0x800) {
+            *out++ = static_cast<char>(0xC0 | (c >> 6));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | (c >> 12));
+            *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        } else {
+            *out++ = static_cast<char>(0xF0 | (c >> 18));
+            *out++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *out++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+    }
+    commit(static_cast<std::size_t>(out - begin));
+    return *this;
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(const char16_t *_Nonnull string) {
+    return append(std::u16string_view{string});
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(CFStringRef _Nullable string) {
+    if (string == nullptr) {
+        return *this;
+    }
+    if (auto direct = cstring_view(string, kCFStringEncodingUTF8); direct) {
+        return append(*direct);
+    }
+
+    const auto range = CFRangeMake(0, CFStringGetLength(string));
+    const auto maximum = CFStringGetMaximumSizeForEncoding(range.length, kCFStringEncodingUTF8);
+    auto *const tail = prepare(static_cast<std::size_t>(maximum));
+    CFIndex length = 0;
+    const auto converted = CFStringGetBytes(string, range, kCFStringEncodingUTF8, 0, false,
+                                            reinterpret_cast<UInt8 *>(tail), maximum, &length);
+    if (converted == range.length) {
+        commit(static_cast<std::size_t>(length));
+        return *this;
+    }
+    // Conversion stops at an unpaired surrogate, so the contents are converted from UTF-16, which replaces it
+    return append(UTF16Buffer<>(string).view());
+}
+
+template <std::size_t N> inline StringBuilder<N> &StringBuilder<N>::append(char c) {
+    buffer_.push_back(c);
+    return *this;
+}
+
+template <std::size_t N>
+template <typename T, std::enable_if_t<std::is_same_v<T, bool>, int>>
+inline StringBuilder<N> &StringBuilder<N>::append(T value) {
+    return append(value ? std::string_view{"true"} : std::string_view{"false"});
+}
+
+template <std::size_t N>
+template <typename T,
+          std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>, int>>
+inline StringBuilder<N> &StringBuilder<N>::append(T value) {
+    // The digits, one more in case the value is near the maximum, and a sign
+    constexpr auto maximum = static_cast<std::size_t>(std::numeric_limits<T>::digits10) + 2;
+    auto *const tail = prepare(maximum);
+    const auto result = std::to_chars(tail, tail + maximum, value);
+    commit(static_cast<std::size_t>(result.ptr - tail));
+    return *this;
+}
+
+template <std::size_t N>
+template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int>>
+inline StringBuilder<N> &StringBuilder<N>::append(T value) {
+    // Enough for the longest shortest-round-trip representation of a long double
+    constexpr std::size_t maximum = 64;
+    auto *const tail = prepare(maximum);
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto result = std::to_chars(tail, tail + maximum, value);
+    commit(static_cast<std::size_t>(result.ptr - tail));
+#else
+    const auto length = std::snprintf(tail, maximum, "%.*Lg", std::numeric_limits<T>::max_digits10,
+                                      static_cast<long double>(value));
+    commit(std::min(static_cast<std::size_t>(std::max(length, 0)), maximum - 1));
+#endif
+    return *this;
+}
+
+template <std::size_t N>
+template <typename T>
+inline StringBuilder<N> &StringBuilder<N>::operator<<(const T &value) {
+    return append(value);
+}
+
+template <std::size_t N> inline void StringBuilder<N>::reserve(std::size_t capacity) { buffer_.reserve(capacity); }
+
+template <std::size_t N> inline std::size_t StringBuilder<N>::size() const noexcept { return buffer_.size(); }
+
+template <std::size_t N> inline bool StringBuilder<N>::empty() const noexcept { return buffer_.empty(); }
+
+template <std::size_t N> inline std::string_view StringBuilder<N>::view() const noexcept {
+    return {buffer_.data(), buffer_.size()};
+}
+
+template <std::size_t N> inline void StringBuilder<N>::clear() noexcept { buffer_.clear(); }
+
+template <std::size_t N> inline CFString StringBuilder<N>::build() const noexcept {
+    return CFString::adopt(CFStringCreateWithBytes(kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(buffer_.data()),
+                                                   static_cast<CFIndex>(buffer_.size()), kCFStringEncodingUTF8,
+                                                   false));
+}
+
+template <typename... Args> inline CFString concat(const Args &...values) {
+    StringBuilder<> builder;
+    (builder.append(values), ...);
+    return builder.build();
+}
+
+constexpr std::ptrdiff_t detail::count_placeholders(std::string_view format) noexcept {
+    std::ptrdiff_t count = 0;
+    for (std::size_t i = 0; i < format.size(); ++i) {
+        if (format[i] == '{') {
+            if (i + 1 == format.size()) {
+                return -1;
+            }
+            if (format[i + 1] == '}') {
+                ++count;
+            } else if (format[i + 1] != '{') {
+                return -1;
+            }
+            ++i;
+        } else if (format[i] == '}') {
+            if (i + 1 == format.size() || format[i + 1] != '}') {
+                return -1;
+            }
+            ++i;
+        }
+    }
+    return count;
+}
+
+template <std::size_t N>
+inline std::size_t detail::append_format_text(StringBuilder<N> &builder, std::string_view format,
+                                              std::size_t position) {
+    // Runs of literal text are appended whole; an escaped brace ends a run after its first character
+    auto start = position;
+    while (position < format.size()) {
+        const auto c = format[position];
+        if (c == '{' && format[position + 1] == '}') {
+            builder.append(format.substr(start, position - start));
+            return position + 2;
+        }
+        if (c == '{' || c == '}') {
+            builder.append(format.substr(start, position + 1 - start));
+            position += 2;
+            start = position;
+            continue;
+        }
+        ++position;
+    }
+    builder.append(format.substr(start));
+    return position;
+}
+
+#if __cpp_nontype_template_args >= 201911L
+
+template <detail::fixed_string Format, typename... Args> inline CFString format(const Args &...values) {
+    constexpr std::string_view string{Format.value, Format.size()};
+    constexpr auto placeholders = detail::count_placeholders(string);
+    static_assert(placeholders >= 0, "cf::format string contains an unmatched brace");
+    static_assert(placeholders == sizeof...(Args), "cf::format requires one value per {} placeholder");
+
+    StringBuilder<> builder;
+    builder.reserve(string.size());
+    std::size_t position = 0;
+    ((position = detail::append_format_text(builder, string, position), builder.append(values)), ...);
+    detail::append_format_text(builder, string, position);
+    return builder.build();
+}
+
+#endif /* __cpp_nontype_template_args >= 201911L */
+
+} /* namespace cf */
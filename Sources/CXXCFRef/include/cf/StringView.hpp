@@ -0,0 +1,190 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+#include "SmallBuffer.hpp"
+
+namespace cf {
+
+/// Returns a view of the contents of a CFString if they are stored contiguously in `encoding`.
+///
+/// No copy is made; the view is valid as long as the string is alive and unmodified.
+/// The encoding must be ASCII-compatible and use a single byte per character, or UTF-8.
+/// @param string A CFString.
+/// @param encoding The desired encoding.
+/// @return A view of the contents, or `std::nullopt` if no direct pointer is available.
+[[nodiscard]] std::optional<std::string_view> cstring_view(CFStringRef _Nonnull string,
+                                                           CFStringEncoding encoding = kCFStringEncodingUTF8) noexcept;
+
+/// Returns a view of the UTF-16 contents of a CFString if they are stored contiguously.
+///
+/// No copy is made; the view is valid as long as the string is alive and unmodified.
+/// @param string A CFString.
+/// @return A view of the contents, or `std::nullopt` if no direct pointer is available.
+[[nodiscard]] std::optional<std::u16string_view> characters_view(CFStringRef _Nonnull string) noexcept;
+
+/// The UTF-8 contents of a CFString.
+///
+/// If the contents are directly accessible they are not copied; otherwise they are converted into inline storage
+/// for `N` bytes, or into a single heap allocation for longer strings. When the contents are not copied the view is
+/// valid only as long as the string is alive and unmodified.
+template <std::size_t N = 256> class UTF8Buffer final {
+  public:
+    /// Constructs a UTF8Buffer containing the contents of a CFString.
+    /// @param string A CFString or null.
+    explicit UTF8Buffer(CFStringRef _Nullable string);
+
+    UTF8Buffer(const UTF8Buffer &) = delete;
+    UTF8Buffer &operator=(const UTF8Buffer &) = delete;
+
+    /// Returns the contents.
+    [[nodiscard]] std::string_view view() const noexcept;
+
+    /// Returns the contents.
+    [[nodiscard]] operator std::string_view() const noexcept;
+
+    /// Returns true if the contents were not copied, which is never the case for a null string.
+    [[nodiscard]] bool isDirect() const noexcept;
+
+  private:
+    /// The contents.
+    std::string_view view_;
+    /// Storage for converted contents.
+    detail::SmallBuffer<char, N> storage_;
+};
+
+/// The UTF-16 contents of a CFString.
+///
+/// If the contents are directly accessible they are not copied; otherwise they are copied into inline storage for
+/// `N` code units, or into a single heap allocation for longer strings. When the contents are not copied the view
+/// is valid only as long as the string is alive and unmodified.
+template <std::size_t N = 128> class UTF16Buffer final {
+  public:
+    /// Constructs a UTF16Buffer containing the contents of a CFString.
+    /// @param string A CFString or null.
+    explicit UTF16Buffer(CFStringRef _Nullable string);
+
+    UTF16Buffer(const UTF16Buffer &) = delete;
+    UTF16Buffer &operator=(const UTF16Buffer &) = delete;
+
+    /// Returns the contents.
+    [[nodiscard]] std::u16string_view view() const noexcept;
+
+    /// Returns the contents.
+    [[nodiscard]] operator std::u16string_view() const noexcept;
+
+    /// Returns true if the contents were not copied, which is never the case for a null string.
+    [[nodiscard]] bool isDirect() const noexcept;
+
+  private:
+    /// The contents.
+    std::u16string_view view_;
+    /// Storage for copied contents.
+    detail::SmallBuffer<char16_t, N> storage_;
+};
+
+namespace detail {
+
+/// Returns true if `pointer` addresses an element of `storage`, or its start if it is empty.
+template <typename T, std::size_t N>
+[[nodiscard]] bool points_into(const T *_Nullable pointer, const SmallBuffer<T, N> &storage) noexcept;
+
+} /* namespace detail */
+
+// MARK: - Implementation -
+
+template <typename T, std::size_t N>
+inline bool detail::points_into(const T *_Nullable pointer, const SmallBuffer<T, N> &storage) noexcept {
+    // std::less gives a total order even for pointers into different objects
+    const T *const first = storage.data();
+    return pointer == first || (!std::less<const T *>{}(pointer, first) &&
+                                std::less<const T *>{}(pointer, first + storage.size()));
+}
+
+inline std::optional<std::string_view> cstring_view(CFStringRef _Nonnull string, CFStringEncoding encoding) noexcept {
+    // A direct pointer is only available when the string is stored with one byte per UTF-16 code unit,
+    // so the length in bytes is the length in code units
+    if (const auto *cstring = CFStringGetCStringPtr(string, encoding); cstring != nullptr) {
+        return std::string_view(cstring, static_cast<std::size_t>(CFStringGetLength(string)));
+    }
+    return std::nullopt;
+}
+
+inline std::optional<std::u16string_view> characters_view(CFStringRef _Nonnull string) noexcept {
+    if (const auto *characters = CFStringGetCharactersPtr(string); characters != nullptr) {
+        return std::u16string_view(reinterpret_cast<const char16_t *>(characters),
+                                   static_cast<std::size_t>(CFStringGetLength(string)));
+    }
+    return std::nullopt;
+}
+
+// MARK: UTF8Buffer
+
+template <std::size_t N> inline UTF8Buffer<N>::UTF8Buffer(CFStringRef _Nullable string) {
+    if (string == nullptr) {
+        return;
+    }
+    if (auto direct = cstring_view(string, kCFStringEncodingUTF8); direct) {
+        view_ = *direct;
+        return;
+    }
+
+    const auto range = CFRangeMake(0, CFStringGetLength(string));
+    CFIndex length = 0;
+    if (CFStringGetMaximumSizeForEncoding(range.length, kCFStringEncodingUTF8) <= static_cast<CFIndex>(N)) {
+        storage_.resize(N);
+    } else {
+        CFStringGetBytes(string, range, kCFStringEncodingUTF8, '?', false, nullptr, 0, &length);
+        storage_.resize(static_cast<std::size_t>(length));
+    }
+    CFStringGetBytes(string, range, kCFStringEncodingUTF8, '?', false, reinterpret_cast<UInt8 *>(storage_.data()),
+                     static_cast<CFIndex>(storage_.size()), &length);
+    view_ = std::string_view(storage_.data(), static_cast<std::size_t>(length));
+}
+
+template <std::size_t N> inline std::string_view UTF8Buffer<N>::view() const noexcept { return view_; }
+
+template <std::size_t N> inline UTF8Buffer<N>::operator std::string_view() const noexcept { return view_; }
+
+template <std::size_t N> inline bool UTF8Buffer<N>::isDirect() const noexcept {
+    return view_.data() != nullptr && !detail::points_into(view_.data(), storage_);
+}
+
+// MARK: UTF16Buffer
+
+template <std::size_t N> inline UTF16Buffer<N>::UTF16Buffer(CFStringRef _Nullable string) {
+    if (string == nullptr) {
+        return;
+    }
+    if (auto direct = characters_view(string); direct) {
+        view_ = *direct;
+        return;
+    }
+
+    const auto length = CFStringGetLength(string);
+    storage_.resize(static_cast<std::size_t>(length));
+    CFStringGetCharacters(string, CFRangeMake(0, length), reinterpret_cast<UniChar *>(storage_.data()));
+    view_ = std::u16string_view(storage_.data(), storage_.size());
+}
+
+template <std::size_t N> inline std::u16string_view UTF16Buffer<N>::view() const noexcept { return view_; }
+
+template <std::size_t N> inline UTF16Buffer<N>::operator std::u16string_view() const noexcept { return view_; }
+
+template <std::size_t N> inline bool UTF16Buffer<N>::isDirect() const noexcept {
+    return view_.data() != nullptr && !detail::points_into(view_.data(), storage_);
+}
+
+} /* namespace cf */
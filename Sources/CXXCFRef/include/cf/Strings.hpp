@@ -0,0 +1,106 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Builders.hpp"
+#include "CFRefCollections.hpp"
+#include "CFRefCore.hpp"
+#include "CFTypeTraits.hpp"
+#include "SmallBuffer.hpp"
+#include "StringView.hpp"
+
+namespace cf {
+
+/// Creates a CFArray of CFStrings from a range of UTF-8 strings.
+///
+/// Elements may be anything convertible to `std::string_view`, such as `std::string` or `const char *`. Each string
+/// is created from its known length with CFStringCreateWithBytes, and the array is created with a single call to
+/// CFArrayCreate.
+/// @param strings A range of UTF-8 strings.
+/// @return A CFArray of CFStrings, or null if an element is not valid UTF-8 or on failure.
+template <typename Range> [[nodiscard]] CFArray to_cf_array(const Range &strings);
+
+/// Converts a CFArray of CFStrings to a vector of UTF-8 strings.
+///
+/// The output is sized once. Strings whose UTF-8 contents are directly accessible are copied straight into the
+/// output; others are converted through a single scratch buffer reused for every element.
+/// @param array A CFArray whose elements are all CFStrings, or null.
+/// @return The UTF-8 contents of the elements.
+[[nodiscard]] std::vector<std::string> to_strings(CFArrayRef _Nullable array);
+
+// MARK: - Implementation -
+
+template <typename Range> inline CFArray to_cf_array(const Range &strings) {
+    detail::SmallBuffer<const void *, detail::builderInlineCapacity> values;
+    values.reserve(detail::size_hint(strings));
+
+    // Release the strings created so far on every path; the array retains its own references
+    struct Releaser {
+        detail::SmallBuffer<const void *, detail::builderInlineCapacity> &values;
+        ~Releaser() {
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                CFRelease(values[i]);
+            }
+        }
+    } releaser{values};
+
+    for (const auto &element : strings) {
+        const std::string_view string{element};
+        // Grow before creating the string so that appending it cannot throw and leak it
+        if (values.size() == values.capacity()) {
+            values.reserve(values.capacity() * 2);
+        }
+        const auto value =
+                CFStringCreateWithBytes(kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(string.data()),
+                                        static_cast<CFIndex>(string.size()), kCFStringEncodingUTF8, false);
+        if (value == nullptr) {
+            return {};
+        }
+        values.push_back(value);
+    }
+
+    return CFArray::adopt(CFArrayCreate(kCFAllocatorDefault, values.data(), static_cast<CFIndex>(values.size()),
+                                        &kCFTypeArrayCallBacks));
+}
+
+inline std::vector<std::string> to_strings(CFArrayRef _Nullable array) {
+    std::vector<std::string> result;
+    if (array == nullptr) {
+        return result;
+    }
+
+    const auto count = CFArrayGetCount(array);
+    detail::SmallBuffer<const void *, detail::builderInlineCapacity> values(static_cast<std::size_t>(count));
+    CFArrayGetValues(array, CFRangeMake(0, count), values.data());
+    result.reserve(values.size());
+
+    detail::SmallBuffer<char, 1024> scratch;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const auto string = detail::element_cast<CFStringRef>(values[i]);
+        if (auto direct = cstring_view(string, kCFStringEncodingUTF8); direct) {
+            result.emplace_back(*direct);
+            continue;
+        }
+
+        const auto range = CFRangeMake(0, CFStringGetLength(string));
+        const auto maximumLength = CFStringGetMaximumSizeForEncoding(range.length, kCFStringEncodingUTF8);
+        scratch.resize(static_cast<std::size_t>(maximumLength));
+        CFIndex length = 0;
+        CFStringGetBytes(string, range, kCFStringEncodingUTF8, '?', false, reinterpret_cast<UInt8 *>(scratch.data()),
+                         static_cast<CFIndex>(scratch.size()), &length);
+        result.emplace_back(scratch.data(), static_cast<std::size_t>(length));
+    }
+    return result;
+}
+
+} /* namespace cf */
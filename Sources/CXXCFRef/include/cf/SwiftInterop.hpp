@@ -0,0 +1,27 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+// These expand to the same attributes as the macros in <swift/bridging>, without requiring that header, and to
+// nothing for compilers that do not support `swift_attr`.
+
+#if defined(__has_attribute)
+#if __has_attribute(swift_attr)
+/// Imports a move-only C++ type into Swift as a `~Copyable` type instead of making it unavailable.
+#define CXXCFREF_SWIFT_NONCOPYABLE __attribute__((swift_attr("~Copyable")))
+/// Imports a `getX()` member function into Swift as the computed property `x`.
+#define CXXCFREF_SWIFT_COMPUTED_PROPERTY __attribute__((swift_attr("import_computed_property")))
+#endif
+#endif
+
+#ifndef CXXCFREF_SWIFT_NONCOPYABLE
+#define CXXCFREF_SWIFT_NONCOPYABLE
+#endif
+#ifndef CXXCFREF_SWIFT_COMPUTED_PROPERTY
+#define CXXCFREF_SWIFT_COMPUTED_PROPERTY
+#endif
@@ -0,0 +1,476 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include <CoreFoundation/CoreFoundation.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cf/ArrayView.hpp"
+#include "cf/Batch.hpp"
+#include "cf/Builders.hpp"
+#include "cf/CFRef.hpp"
+#include "cf/Paths.hpp"
+#include "cf/StringBuilder.hpp"
+#include "cf/StringView.hpp"
+
+namespace {
+
+// MARK: Harness
+
+/// Prevents the compiler from optimizing away a computed value.
+template <typename T> inline void doNotOptimize(const T &value) noexcept {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Creates a string long enough that it is never represented as a tagged pointer.
+CFStringRef createString(const char *suffix) noexcept {
+    char buf[128];
+    std::snprintf(buf, sizeof buf, "org.sbooth.CXXCFRef.benchmark.fixture.%s", suffix);
+    return CFStringCreateWithCString(kCFAllocatorDefault, buf, kCFStringEncodingUTF8);
+}
+
+/// Creates an array containing `count` references to `value`.
+CFArrayRef createArray(CFTypeRef value, CFIndex count) noexcept {
+    std::vector<CFTypeRef> values(static_cast<std::size_t>(count), value);
+    return CFArrayCreate(kCFAllocatorDefault, values.data(), count, &kCFTypeArrayCallBacks);
+}
+
+/// Creates `count` distinct strings.
+std::vector<cf::CFString> createKeys(std::size_t count) {
+    std::vector<cf::CFString> keys;
+    for (std::size_t i = 0; i < count; ++i) {
+        char suffix[32];
+        std::snprintf(suffix, sizeof suffix, "key.%zu", i);
+        keys.push_back(cf::CFString::adopt(createString(suffix)));
+    }
+    return keys;
+}
+
+/// Creates a file URL for a path typical of a music library.
+CFURLRef createURL() noexcept {
+    constexpr std::string_view path{"/Users/Shared/Music/Artist Name/Album Title (Deluxe Edition)/01 Track Title.flac"};
+    return CFURLCreateFromFileSystemRepresentation(kCFAllocatorDefault, reinterpret_cast<const UInt8 *>(path.data()),
+                                                   static_cast<CFIndex>(path.size()), false);
+}
+
+/// Core Foundation objects shared by all threads.
+struct Fixtures {
+    cf::CFString shared{createString("shared")};
+    cf::CFString equal{createString("shared")};
+    cf::CFString unequal{createString("unequal")};
+    cf::CFArray array{createArray(shared.get(), 1024)};
+    std::vector<cf::CFString> keys{createKeys(32)};
+    cf::CFURL url{createURL()};
+};
+
+/// A single benchmark case.
+///
+/// The body is invoked once per thread and must perform `iterations` operations.
+struct Benchmark {
+    const char *name;
+    void (*body)(const Fixtures &fixtures, std::size_t iterations);
+};
+
+/// Options controlling a benchmark run.
+struct Options {
+    std::size_t iterations{1'000'000};
+    std::size_t repetitions{5};
+    std::vector<unsigned> threadCounts;
+    std::string_view filter;
+};
+
+/// Runs a benchmark on `threads` threads and returns the wall-clock time in nanoseconds.
+double runOnce(const Benchmark &benchmark, const Fixtures &fixtures, unsigned threads, std::size_t iterations) {
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.emplace_back([&] {
+            ready.fetch_add(1, std::memory_order_acq_rel);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            benchmark.body(fixtures, iterations);
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) != threads) {
+        std::this_thread::yield();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/// Runs a benchmark for each configured thread count and prints the time per operation.
+void run(const Benchmark &benchmark, const Fixtures &fixtures, const Options &options) {
+    if (!options.filter.empty() && std::string_view(benchmark.name).find(options.filter) == std::string_view::npos) {
+        return;
+    }
+
+    for (auto threads : options.threadCounts) {
+        std::vector<double> samples;
+        samples.reserve(options.repetitions);
+
+        // Warm up caches and the allocator before sampling
+        runOnce(benchmark, fixtures, threads, options.iterations / 10 + 1);
+        for (std::size_t i = 0; i < options.repetitions; ++i) {
+            const auto elapsed = runOnce(benchmark, fixtures, threads, options.iterations);
+            samples.push_back(elapsed / static_cast<double>(options.iterations));
+        }
+
+        std::sort(samples.begin(), samples.end());
+        std::printf("%-32s %8u %12.2f %12.2f %12.2f\n", benchmark.name, threads, samples.front(),
+                    samples[samples.size() / 2], samples.back());
+    }
+}
+
+// MARK: Ownership
+
+void adopt(const Fixtures &fixtures, std::size_t n) {
+    const auto object = fixtures.shared.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        auto ref = cf::CFString::adopt(static_cast<CFStringRef>(CFRetain(object)));
+        doNotOptimize(ref);
+    }
+}
+
+void retain(const Fixtures &fixtures, std::size_t n) {
+    const auto object = fixtures.shared.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        auto ref = cf::CFString::retain(object);
+        doNotOptimize(ref);
+    }
+}
+
+// MARK: Copy and Move
+
+void copyConstruct(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        cf::CFString ref{fixtures.shared};
+        doNotOptimize(ref);
+    }
+}
+
+/// Copies a reference to a constant; CFBoolean is immortal so no reference counting takes place.
+void copyConstructImmortal(const Fixtures & /*fixtures*/, std::size_t n) {
+    const auto constant = cf::CFBoolean::retain(kCFBooleanTrue);
+    for (std::size_t i = 0; i < n; ++i) {
+        cf::CFBoolean ref{constant};
+        doNotOptimize(ref);
+    }
+}
+
+void copyAssign(const Fixtures &fixtures, std::size_t n) {
+    cf::CFString ref{fixtures.unequal};
+    for (std::size_t i = 0; i < n; ++i) {
+        ref = (i & 1) != 0 ? fixtures.unequal : fixtures.shared;
+        doNotOptimize(ref);
+    }
+}
+
+void moveConstruct(const Fixtures &fixtures, std::size_t n) {
+    cf::CFString ref{fixtures.shared};
+    for (std::size_t i = 0; i < n; ++i) {
+        cf::CFString moved{std::move(ref)};
+        doNotOptimize(moved);
+        ref = std::move(moved);
+    }
+}
+
+void moveAssign(const Fixtures &fixtures, std::size_t n) {
+    cf::CFString a{fixtures.shared};
+    cf::CFString b;
+    for (std::size_t i = 0; i < n; ++i) {
+        b = std::move(a);
+        doNotOptimize(b);
+        a = std::move(b);
+    }
+}
+
+// MARK: Equality
+
+void isEqualIdentical(const Fixtures &fixtures, std::size_t n) {
+    const auto object = fixtures.shared.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        doNotOptimize(fixtures.shared.isEqual(object));
+    }
+}
+
+void isEqualEqual(const Fixtures &fixtures, std::size_t n) {
+    const auto object = fixtures.equal.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        doNotOptimize(fixtures.shared.isEqual(object));
+    }
+}
+
+void isEqualUnequal(const Fixtures &fixtures, std::size_t n) {
+    const auto object = fixtures.unequal.get();
+    for (std::size_t i = 0; i < n; ++i) {
+        doNotOptimize(fixtures.shared.isEqual(object));
+    }
+}
+
+// MARK: Containers
+
+/// Each operation is one insertion; the vector is discarded every 4096 elements so it keeps reallocating.
+void vectorGrowth(const Fixtures &fixtures, std::size_t n) {
+    constexpr std::size_t batch = 4096;
+    std::vector<cf::CFString> v;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (v.size() == batch) {
+            v = {};
+        }
+        v.push_back(fixtures.shared);
+    }
+    doNotOptimize(v.data());
+}
+
+/// Each operation copies one element into a vector of 4096 and releases it, either by destroying the vector or, with
+/// Deferred, by handing the releases to the deferred release queue using release_all.
+template <bool Deferred> void releaseVector(const Fixtures &fixtures, std::size_t n) {
+    constexpr std::size_t batch = 4096;
+    for (std::size_t i = 0; i < n; i += batch) {
+        std::vector<cf::CFString> v(batch, fixtures.shared);
+        if constexpr (Deferred) {
+            cf::release_all(v.data(), v.data() + v.size(), cf::ReleaseMode::deferred);
+        }
+        doNotOptimize(v.data());
+    }
+}
+
+/// Each operation visits one array element.
+void arrayGetValueAtIndex(const Fixtures &fixtures, std::size_t n) {
+    const auto count = CFArrayGetCount(fixtures.array);
+    for (std::size_t i = 0; i < n;) {
+        for (CFIndex j = 0; j < count && i < n; ++j, ++i) {
+            doNotOptimize(static_cast<CFStringRef>(CFArrayGetValueAtIndex(fixtures.array, j)));
+        }
+    }
+}
+
+/// Each operation visits one array element.
+void arrayView(const Fixtures &fixtures, std::size_t n) {
+    const cf::ArrayView<CFStringRef> view{fixtures.array};
+    for (std::size_t i = 0; i < n;) {
+        for (auto it = view.begin(), end = view.end(); it != end && i < n; ++it, ++i) {
+            doNotOptimize(*it);
+        }
+    }
+}
+
+// MARK: Paths
+
+/// Each operation converts a URL to a path by copying a CFString and converting it to a std::string.
+void urlCopyPath(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto path = cf::CFString::adopt(CFURLCopyFileSystemPath(fixtures.url, kCFURLPOSIXPathStyle));
+        std::string s(static_cast<std::size_t>(CFStringGetMaximumSizeOfFileSystemRepresentation(path)), '\0');
+        CFStringGetFileSystemRepresentation(path, s.data(), static_cast<CFIndex>(s.size()));
+        doNotOptimize(s.data());
+    }
+}
+
+/// Each operation converts a URL to a path in a stack buffer using with_fs_path.
+void withFSPath(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        cf::with_fs_path(fixtures.url, [](std::string_view path) { doNotOptimize(path.data()); });
+    }
+}
+
+// MARK: Strings
+
+/// Each operation converts a string to UTF-8 by allocating a std::string.
+void stringCopy(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto length = CFStringGetLength(fixtures.shared);
+        std::string s(static_cast<std::size_t>(CFStringGetMaximumSizeForEncoding(length, kCFStringEncodingUTF8)) + 1,
+                      '\0');
+        CFStringGetCString(fixtures.shared, s.data(), static_cast<CFIndex>(s.size()), kCFStringEncodingUTF8);
+        doNotOptimize(s.data());
+    }
+}
+
+/// Each operation obtains the UTF-8 contents of a string using UTF8Buffer.
+void utf8Buffer(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const cf::UTF8Buffer<> buffer{fixtures.shared};
+        doNotOptimize(buffer.view().data());
+    }
+}
+
+/// Each operation creates a string from a string and an integer using CFStringCreateWithFormat.
+void stringCreateWithFormat(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto string = cf::CFString::adopt(CFStringCreateWithFormat(
+                kCFAllocatorDefault, nullptr, CFSTR("%@-%ld.key"), fixtures.shared.get(), static_cast<long>(i)));
+        doNotOptimize(string.get());
+    }
+}
+
+/// Each operation creates a string from a string and an integer using concat.
+void stringBuilderConcat(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto string = cf::concat(fixtures.shared, '-', i, ".key");
+        doNotOptimize(string.get());
+    }
+}
+
+/// Each operation builds a dictionary of 32 pairs by inserting into a mutable dictionary.
+void dictionarySetValue(const Fixtures &fixtures, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto dictionary = cf::CFMutableDictionary::adopt(CFDictionaryCreateMutable(
+                kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks));
+        for (const auto &key : fixtures.keys) {
+            CFDictionarySetValue(dictionary, key, fixtures.shared);
+        }
+        doNotOptimize(dictionary.get());
+    }
+}
+
+/// Each operation builds a dictionary of 32 pairs using make_dictionary.
+void makeDictionary(const Fixtures &fixtures, std::size_t n) {
+    std::vector<std::pair<CFStringRef, CFStringRef>> pairs;
+    for (const auto &key : fixtures.keys) {
+        pairs.emplace_back(key, fixtures.shared);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto dictionary = cf::make_dictionary(pairs);
+        doNotOptimize(dictionary.get());
+    }
+}
+
+/// Each operation relocates one element; elements move back and forth between two buffers of 4096 elements.
+template <bool UseRelocate> void relocateArray(const Fixtures &fixtures, std::size_t n) {
+    constexpr std::size_t batch = 4096;
+    std::allocator<cf::CFString> allocator;
+    auto *source = allocator.allocate(batch);
+    auto *destination = allocator.allocate(batch);
+    std::uninitialized_fill_n(source, batch, fixtures.shared);
+    for (std::size_t i = 0; i < n; i += batch) {
+        if constexpr (UseRelocate) {
+            cf::uninitialized_relocate(source, source + batch, destination);
+        } else {
+            std::uninitialized_move(source, source + batch, destination);
+            std::destroy(source, source + batch);
+        }
+        std::swap(source, destination);
+        doNotOptimize(source);
+    }
+    std::destroy(source, source + batch);
+    allocator.deallocate(source, batch);
+    allocator.deallocate(destination, batch);
+}
+
+constexpr Benchmark benchmarks[] = {
+        {"adopt", adopt},
+        {"retain", retain},
+        {"copy_construct", copyConstruct},
+        {"copy_construct_immortal", copyConstructImmortal},
+        {"copy_assign", copyAssign},
+        {"move_construct", moveConstruct},
+        {"move_assign", moveAssign},
+        {"isEqual_identical", isEqualIdentical},
+        {"isEqual_equal", isEqualEqual},
+        {"isEqual_unequal", isEqualUnequal},
+        {"vector_growth", vectorGrowth},
+        {"release_vector", releaseVector<false>},
+        {"release_all_deferred", releaseVector<true>},
+        {"string_copy", stringCopy},
+        {"utf8_buffer", utf8Buffer},
+        {"string_create_with_format", stringCreateWithFormat},
+        {"string_builder_concat", stringBuilderConcat},
+        {"url_copy_path", urlCopyPath},
+        {"with_fs_path", withFSPath},
+        {"dictionary_set_value", dictionarySetValue},
+        {"make_dictionary", makeDictionary},
+        {"relocate_move_destroy", relocateArray<false>},
+        {"relocate_memcpy", relocateArray<true>},
+        {"array_get_value_at_index", arrayGetValueAtIndex},
+        {"array_view", arrayView},
+};
+
+// MARK: Command Line
+
+void usage(const char *argv0) {
+    std::fprintf(stderr,
+                 "Usage: %s [--iterations N] [--repetitions N] [--threads N[,N...]] [--filter SUBSTRING]\n"
+                 "Reports the minimum, median and maximum nanoseconds per operation per thread.\n",
+                 argv0);
+}
+
+bool parseThreadCounts(const char *arg, std::vector<unsigned> &counts) {
+    counts.clear();
+    for (const char *p = arg; *p != '\0';) {
+        char *end = nullptr;
+        const auto value = std::strtoul(p, &end, 10);
+        if (end == p || value == 0) {
+            return false;
+        }
+        counts.push_back(static_cast<unsigned>(value));
+        p = *end == ',' ? end + 1 : end;
+    }
+    return !counts.empty();
+}
+
+} /* namespace */
+
+int main(int argc, char *argv[]) {
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--iterations" && hasValue) {
+            options.iterations = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--repetitions" && hasValue) {
+            options.repetitions = std::max<std::size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--threads" && hasValue) {
+            if (!parseThreadCounts(argv[++i], options.threadCounts)) {
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+        } else if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.threadCounts.empty()) {
+        options.threadCounts = {1, std::max(2u, std::thread::hardware_concurrency())};
+    }
+
+    const Fixtures fixtures;
+    std::printf("%-32s %8s %12s %12s %12s\n", "benchmark", "threads", "min ns/op", "median ns/op", "max ns/op");
+    for (const auto &benchmark : benchmarks) {
+        run(benchmark, fixtures, options);
+    }
+
+    return EXIT_SUCCESS;
+}
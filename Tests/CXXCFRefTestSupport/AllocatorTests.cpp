@@ -0,0 +1,190 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "cf/Allocators.hpp"
+#include "cf/CFRef.hpp"
+
+namespace {
+
+/// Returns true if `ptr` is non-null and aligned as `malloc` aligns allocations.
+bool isAligned(const void *_Nullable ptr) noexcept {
+    return ptr != nullptr && reinterpret_cast<std::uintptr_t>(ptr) % 16 == 0;
+}
+
+/// Creates objects from `allocator` and checks that the allocator's retain count returns to one once they are
+/// released, so the allocator frees its memory when the caller releases it.
+bool releasesObjects(CFAllocatorRef _Nonnull allocator) {
+    constexpr std::size_t count = 256;
+    const UInt8 bytes[64] = {};
+    {
+        std::vector<cf::CFData> objects;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto data = cf::CFData::adopt(CFDataCreate(allocator, bytes, static_cast<CFIndex>(i % sizeof bytes)));
+            if (!data || CFGetAllocator(data.get()) != allocator) {
+                return false;
+            }
+            objects.push_back(std::move(data));
+        }
+        if (CFGetRetainCount(allocator) <= 1) {
+            return false;
+        }
+    }
+    return CFGetRetainCount(allocator) == 1;
+}
+
+} /* namespace */
+
+bool cftest::arenaAllocator() {
+    const auto arena = cf::ArenaAllocator::create(4096);
+    if (!arena) {
+        return false;
+    }
+
+    auto *first = static_cast<char *>(CFAllocatorAllocate(arena, 24, 0));
+    auto *second = static_cast<char *>(CFAllocatorAllocate(arena, 24, 0));
+    if (!isAligned(first) || !isAligned(second) || first == second) {
+        return false;
+    }
+    std::memset(first, 'a', 24);
+    std::memset(second, 'b', 24);
+
+    // The most recent allocation grows in place; an earlier one is copied
+    auto *grown = static_cast<char *>(CFAllocatorReallocate(arena, second, 200, 0));
+    auto *moved = static_cast<char *>(CFAllocatorReallocate(arena, first, 200, 0));
+    if (grown != second || !isAligned(moved) || moved == first || moved[0] != 'a' || moved[23] != 'a' ||
+        grown[23] != 'b') {
+        return false;
+    }
+
+    // Requests larger than a quarter of the block size get a dedicated block
+    auto *large = static_cast<char *>(CFAllocatorAllocate(arena, 8192, 0));
+    if (!isAligned(large)) {
+        return false;
+    }
+    std::memset(large, 'c', 8192);
+    auto *next = static_cast<char *>(CFAllocatorAllocate(arena, 24, 0));
+    if (!isAligned(next) || grown[199] == 'c') {
+        return false;
+    }
+
+    // Deallocation is a no-op until the arena itself is freed
+    CFAllocatorDeallocate(arena, grown);
+    CFAllocatorDeallocate(arena, moved);
+    CFAllocatorDeallocate(arena, large);
+    CFAllocatorDeallocate(arena, next);
+    return releasesObjects(arena) && CFGetRetainCount(arena.get()) == 1;
+}
+
+bool cftest::poolAllocator() {
+    const auto pool = cf::PoolAllocator::create(4096);
+    if (!pool) {
+        return false;
+    }
+
+    // Freed blocks are reused by requests of the same size class
+    auto *block = CFAllocatorAllocate(pool, 100, 0);
+    if (!isAligned(block)) {
+        return false;
+    }
+    CFAllocatorDeallocate(pool, block);
+    if (CFAllocatorAllocate(pool, 120, 0) != block) {
+        return false;
+    }
+
+    // Reallocating within a size class keeps the block; crossing classes copies the contents
+    std::memset(block, 'p', 100);
+    if (CFAllocatorReallocate(pool, block, 128, 0) != block) {
+        return false;
+    }
+    auto *larger = static_cast<char *>(CFAllocatorReallocate(pool, block, 600, 0));
+    if (!isAligned(larger) || larger == block || larger[0] != 'p' || larger[99] != 'p') {
+        return false;
+    }
+    if (CFAllocatorAllocate(pool, 128, 0) != block) {
+        return false;
+    }
+    CFAllocatorDeallocate(pool, block);
+    CFAllocatorDeallocate(pool, larger);
+
+    // Requests above the largest size class are forwarded to malloc
+    auto *unpooled = static_cast<char *>(CFAllocatorAllocate(pool, 4096, 0));
+    if (!isAligned(unpooled)) {
+        return false;
+    }
+    std::memset(unpooled, 'u', 4096);
+    unpooled = static_cast<char *>(CFAllocatorReallocate(pool, unpooled, 8192, 0));
+    if (!isAligned(unpooled) || unpooled[4095] != 'u') {
+        return false;
+    }
+    CFAllocatorDeallocate(pool, unpooled);
+
+    return releasesObjects(pool) && CFGetRetainCount(pool.get()) == 1;
+}
+
+bool cftest::poolAllocatorConcurrentUse() {
+    const auto pool = cf::PoolAllocator::create();
+    if (!pool) {
+        return false;
+    }
+
+    std::atomic<bool> passed{true};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&pool, &passed, i] {
+            std::vector<unsigned char *> blocks;
+            for (int j = 0; j < 2000; ++j) {
+                const auto size = static_cast<CFIndex>(16 + (j * 37) % 1500);
+                auto *block = static_cast<unsigned char *>(CFAllocatorAllocate(pool, size, 0));
+                if (!isAligned(block)) {
+                    passed = false;
+                    return;
+                }
+                std::memset(block, i, static_cast<std::size_t>(size));
+                blocks.push_back(block);
+                // Free every other block so free lists are reused while other threads allocate
+                if (j % 2 == 1) {
+                    CFAllocatorDeallocate(pool, blocks[blocks.size() - 2]);
+                    blocks.erase(blocks.end() - 2);
+                }
+            }
+            for (auto *block : blocks) {
+                if (block[0] != static_cast<unsigned char>(i)) {
+                    passed = false;
+                }
+                CFAllocatorDeallocate(pool, block);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return passed && CFGetRetainCount(pool.get()) == 1;
+}
+
+bool cftest::scopedDefaultAllocator() {
+    // A default allocator is never deallocated, so use system allocators rather than leak an arena or pool
+    const auto original = CFAllocatorGetDefault();
+    bool passed = true;
+    {
+        const cf::ScopedDefaultAllocator outer{kCFAllocatorMalloc};
+        passed = passed && CFAllocatorGetDefault() == kCFAllocatorMalloc;
+        {
+            const cf::ScopedDefaultAllocator inner{kCFAllocatorMallocZone};
+            passed = passed && CFAllocatorGetDefault() == kCFAllocatorMallocZone;
+        }
+        passed = passed && CFAllocatorGetDefault() == kCFAllocatorMalloc;
+    }
+    return passed && CFAllocatorGetDefault() == original;
+}
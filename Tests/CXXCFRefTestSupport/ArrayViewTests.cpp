@@ -0,0 +1,150 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstdio>
+#include <iterator>
+#include <vector>
+
+#include "cf/ArrayView.hpp"
+#include "cf/Builders.hpp"
+
+namespace {
+
+/// The number of elements in the test array, which spans several chunks and ends partway through one.
+constexpr CFIndex elementCount = 3 * cf::ArrayView<CFStringRef>::chunkSize + 5;
+
+/// Creates an array of distinct strings.
+cf::CFArray makeArray() {
+    std::vector<cf::CFString> strings;
+    for (CFIndex i = 0; i < elementCount; ++i) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof buffer, "element %ld", static_cast<long>(i));
+        strings.push_back(cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, buffer,
+                                                                          kCFStringEncodingUTF8)));
+    }
+    return cf::make_array(strings);
+}
+
+/// Returns true if `element` is the element of `array` at `index`.
+bool isElement(CFArrayRef _Nonnull array, CFIndex index, CFStringRef _Nullable element) noexcept {
+    return index >= 0 && index < elementCount && element == CFArrayGetValueAtIndex(array, index);
+}
+
+} /* namespace */
+
+bool cftest::arrayViewForwardIteration() {
+    const auto array = makeArray();
+    const cf::ArrayView<CFStringRef> view{array};
+    if (!array || view.size() != static_cast<std::size_t>(elementCount)) {
+        return false;
+    }
+
+    CFIndex index = 0;
+    for (const auto element : view) {
+        if (!isElement(array, index++, element)) {
+            return false;
+        }
+    }
+    if (index != elementCount) {
+        return false;
+    }
+
+    // Postfix results hold the element they were created at
+    index = 0;
+    for (auto it = view.begin(); it != view.end();) {
+        if (!isElement(array, index++, *it++)) {
+            return false;
+        }
+    }
+
+    // A copy made after the chunk was fetched reads the same elements
+    auto it = view.begin();
+    (void)*it;
+    for (auto copy = it; copy != view.end(); ++copy, ++it) {
+        if (*copy != *it || !isElement(array, copy - view.begin(), *copy)) {
+            return false;
+        }
+    }
+    return std::vector<CFStringRef>(view.begin(), view.end()).size() == view.size();
+}
+
+bool cftest::arrayViewBackwardIteration() {
+    const auto array = makeArray();
+    const cf::ArrayView<CFStringRef> view{array};
+    if (!array) {
+        return false;
+    }
+
+    CFIndex index = elementCount;
+    for (auto it = view.end(); it != view.begin();) {
+        if (!isElement(array, --index, *--it)) {
+            return false;
+        }
+    }
+    if (index != 0) {
+        return false;
+    }
+
+    index = elementCount - 1;
+    auto it = view.end() - 1;
+    for (; it != view.begin(); --index) {
+        if (!isElement(array, index, *it--)) {
+            return false;
+        }
+    }
+    if (index != 0 || !isElement(array, 0, *it)) {
+        return false;
+    }
+
+    index = elementCount;
+    for (auto reverse = std::make_reverse_iterator(view.end()); reverse != std::make_reverse_iterator(view.begin());
+         ++reverse) {
+        if (!isElement(array, --index, *reverse)) {
+            return false;
+        }
+    }
+    return index == 0;
+}
+
+bool cftest::arrayViewRandomAccess() {
+    const auto array = makeArray();
+    const cf::ArrayView<CFStringRef> view{array};
+    if (!array || view.end() - view.begin() != elementCount) {
+        return false;
+    }
+
+    // Jump between chunks in both directions, reusing an iterator whose chunk no longer covers its position
+    constexpr CFIndex chunkSize = cf::ArrayView<CFStringRef>::chunkSize;
+    auto it = view.begin();
+    for (const CFIndex index : {CFIndex{0}, chunkSize - 1, chunkSize, 3 * chunkSize + 4, chunkSize + 1, CFIndex{2}}) {
+        it = view.begin() + index;
+        if (!isElement(array, index, *it) || !isElement(array, index, view[static_cast<std::size_t>(index)]) ||
+            !isElement(array, index, view.begin()[index])) {
+            return false;
+        }
+    }
+
+    // Subscripts reach outside the chunk of the iterator they are applied to
+    it = view.begin() + chunkSize;
+    (void)*it;
+    for (CFIndex offset = -chunkSize; offset < elementCount - chunkSize; ++offset) {
+        if (!isElement(array, chunkSize + offset, it[offset])) {
+            return false;
+        }
+    }
+
+    // Assignment carries the chunk, so the target reads the same elements as the source
+    auto target = view.end();
+    target = it;
+    target -= 1;
+    it += 2;
+    return isElement(array, chunkSize - 1, *target) && isElement(array, chunkSize + 2, *it) && target < it &&
+           it - target == 3 && view.front() == CFArrayGetValueAtIndex(array, 0) &&
+           view.back() == CFArrayGetValueAtIndex(array, elementCount - 1) && cf::ArrayView<CFStringRef>{}.empty();
+}
@@ -0,0 +1,120 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "cf/AtomicCFRef.hpp"
+#include "cf/CFRef.hpp"
+
+namespace {
+
+/// Returns a new, empty mutable data object, which is never a tagged pointer.
+cf::CFMutableData makeData() { return cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0)); }
+
+} /* namespace */
+
+bool cftest::atomicCFRefCompareExchange() {
+    const auto first = makeData();
+    const auto second = makeData();
+    const auto third = makeData();
+    bool passed = true;
+    {
+        cf::AtomicCFRef<CFMutableDataRef> atomic{first};
+
+        // A failed exchange returns the current object in expected
+        auto expected = second;
+        passed = passed && !atomic.compare_exchange_strong(expected, third) && expected.get() == first.get();
+        passed = passed && CFGetRetainCount(first.get()) == 3 && CFGetRetainCount(third.get()) == 1;
+
+        // expected now matches, so the exchange succeeds; weak exchanges may fail spuriously
+        while (!atomic.compare_exchange_weak(expected, third)) {
+            passed = passed && expected.get() == first.get();
+        }
+        const auto current = atomic.load();
+        passed = passed && current.get() == third.get() && CFGetRetainCount(first.get()) == 2 &&
+                 CFGetRetainCount(third.get()) == 3;
+
+        auto previous = atomic.exchange(nullptr);
+        passed = passed && previous.get() == third.get() && !atomic.load();
+        atomic = second;
+    }
+    return passed && CFGetRetainCount(first.get()) == 1 && CFGetRetainCount(second.get()) == 1 &&
+           CFGetRetainCount(third.get()) == 1;
+}
+
+bool cftest::atomicCFRefConcurrentLoadStore() {
+    constexpr std::size_t objectCount = 8;
+    constexpr int readerCount = 4;
+    constexpr int writerCount = 2;
+    constexpr int iterations = 20000;
+
+    std::array<cf::CFMutableData, objectCount> objects;
+    std::generate(objects.begin(), objects.end(), makeData);
+    const auto isKnown = [&objects](CFMutableDataRef object) {
+        return std::any_of(objects.begin(), objects.end(), [object](const auto &ref) { return ref.get() == object; });
+    };
+
+    std::atomic<bool> passed{true};
+    {
+        cf::AtomicCFRef<CFMutableDataRef> atomic{objects[0]};
+        std::atomic<bool> stop{false};
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < readerCount; ++i) {
+            threads.emplace_back([&] {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    // Every loaded object is valid and holds its own reference
+                    const auto object = atomic.load();
+                    if (!object || !isKnown(object.get()) || CFGetRetainCount(object.get()) < 2) {
+                        passed = false;
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < writerCount; ++i) {
+            threads.emplace_back([&, i] {
+                auto expected = atomic.load();
+                for (int j = 0; j < iterations; ++j) {
+                    const auto &desired = objects[static_cast<std::size_t>(i + j) % objectCount];
+                    switch (j % 3) {
+                        case 0:
+                            atomic.store(desired);
+                            break;
+                        case 1:
+                            if (const auto previous = atomic.exchange(desired); !isKnown(previous.get())) {
+                                passed = false;
+                            }
+                            break;
+                        default:
+                            if (!atomic.compare_exchange_weak(expected, desired) && !isKnown(expected.get())) {
+                                passed = false;
+                            }
+                            break;
+                    }
+                }
+            });
+        }
+
+        for (auto it = threads.begin() + readerCount; it != threads.end(); ++it) {
+            it->join();
+        }
+        stop = true;
+        for (auto it = threads.begin(); it != threads.begin() + readerCount; ++it) {
+            it->join();
+        }
+    }
+
+    // Destroying the AtomicCFRef released the last stored object, so only the array holds references
+    return passed && std::all_of(objects.begin(), objects.end(),
+                                 [](const auto &ref) { return CFGetRetainCount(ref.get()) == 1; });
+}
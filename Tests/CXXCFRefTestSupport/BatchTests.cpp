@@ -0,0 +1,183 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cf/Batch.hpp"
+#include "cf/DeferredRelease.hpp"
+#include "cf/Span.hpp"
+
+namespace {
+
+/// Uninitialized storage for `N` CFRefs.
+template <std::size_t N> struct Storage final {
+    cf::CFMutableData *_Nonnull data() noexcept { return reinterpret_cast<cf::CFMutableData *>(bytes); }
+
+    alignas(cf::CFMutableData) unsigned char bytes[N * sizeof(cf::CFMutableData)];
+};
+
+/// Creates mutable data, which is never a tagged pointer, so its retain count is meaningful.
+cf::CFMutableData makeData() { return cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0)); }
+
+/// Returns true if every CFRef in a range is null.
+template <typename Range> bool allNull(const Range &refs) noexcept {
+    for (const auto &ref : refs) {
+        if (ref) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Drains the shared deferred release queue and waits up to one second for an object's retain count to reach `count`.
+///
+/// The queue's own drain thread may have dequeued an object without having released it yet, so the count is polled.
+bool drainUntilRetainCount(CFTypeRef _Nonnull object, CFIndex count) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+    for (;;) {
+        cf::DeferredRelease::shared().drain();
+        if (CFGetRetainCount(object) == count) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+/// Copies `refs` with retain_all, checks the retain count, and releases the copies with release_all.
+template <typename Container>
+bool retainsAndReleases(const Container &refs, CFTypeRef _Nonnull object, CFIndex nonNull, cf::ReleaseMode mode) {
+    const auto before = CFGetRetainCount(object);
+    Storage<4> storage;
+    auto *const first = storage.data();
+    auto *const last = cf::retain_all(refs, first);
+    const auto count = static_cast<std::size_t>(last - first);
+    bool result = count == std::size(refs) && CFGetRetainCount(object) == before + nonNull;
+    for (std::size_t i = 0; i < count; ++i) {
+        result = result && first[i].get() == std::data(refs)[i].get();
+    }
+
+    cf::release_all(first, last, mode);
+    result = result && allNull(cf::span<cf::CFMutableData>(first, count));
+    std::destroy(first, last);
+    if (mode == cf::ReleaseMode::immediate) {
+        return result && CFGetRetainCount(object) == before;
+    }
+    return result && drainUntilRetainCount(object, before);
+}
+
+} /* namespace */
+
+bool cftest::batchRetainAllContainers() {
+    const auto data = makeData();
+    const std::vector<cf::CFMutableData> vector{data, cf::CFMutableData{}, data};
+    const std::array<cf::CFMutableData, 4> array{data, data, data, cf::CFMutableData{}};
+    std::vector<cf::CFMutableData> mutableVector{data, data};
+    for (const auto mode : {cf::ReleaseMode::immediate, cf::ReleaseMode::deferred}) {
+        if (!retainsAndReleases(vector, data, 2, mode) || !retainsAndReleases(array, data, 3, mode) ||
+            !retainsAndReleases(cf::span<const cf::CFMutableData>(vector), data, 2, mode) ||
+            !retainsAndReleases(cf::span<cf::CFMutableData>(mutableVector), data, 2, mode)) {
+            return false;
+        }
+    }
+    return CFGetRetainCount(data.get()) == 1 + 2 + 3 + 2;
+}
+
+bool cftest::batchReleaseAllContainers() {
+    const auto data = makeData();
+
+    // Immediate mode releases on the calling thread
+    std::vector<cf::CFMutableData> vector{data, cf::CFMutableData{}, data};
+    std::array<cf::CFMutableData, 2> array{data, data};
+    if (CFGetRetainCount(data.get()) != 5) {
+        return false;
+    }
+    cf::release_all(vector);
+    cf::release_all(cf::span<cf::CFMutableData>(array));
+    if (CFGetRetainCount(data.get()) != 1 || vector.size() != 3 || !allNull(vector) || !allNull(array)) {
+        return false;
+    }
+
+    // Deferred mode leaves the CFRefs null at once and releases the objects once the queue is drained
+    vector.assign(3, data);
+    array = {data, cf::CFMutableData{}};
+    cf::release_all(vector, cf::ReleaseMode::deferred);
+    cf::release_all(array, cf::ReleaseMode::deferred);
+    if (!allNull(vector) || !allNull(array) || !drainUntilRetainCount(data.get(), 1)) {
+        return false;
+    }
+
+    // An empty or all-null range hands nothing to the queue
+    std::vector<cf::CFMutableData> empty;
+    std::array<cf::CFMutableData, 2> nulls;
+    cf::release_all(empty, cf::ReleaseMode::deferred);
+    cf::release_all(nulls, cf::ReleaseMode::deferred);
+    return allNull(nulls) && CFGetRetainCount(data.get()) == 1;
+}
+
+bool cftest::refBufferRetainCounts() {
+    const auto data = makeData();
+    for (const auto mode : {cf::ReleaseMode::immediate, cf::ReleaseMode::deferred}) {
+        {
+            // Two inline slots, so the third object moves the storage to the heap
+            cf::RefBuffer<CFMutableDataRef, 2> buffer{mode};
+            buffer.push_back(data);
+            buffer.push_back(cf::CFMutableData{});
+            auto moved = data;
+            buffer.push_back(std::move(moved));
+            if (buffer.size() != 3 || buffer[1] != nullptr || moved || CFGetRetainCount(data.get()) != 3 ||
+                buffer.releaseMode() != mode) {
+                return false;
+            }
+
+            // Copies retain each non-null object and keep the release mode
+            auto copy = buffer;
+            cf::RefBuffer<CFMutableDataRef, 2> assigned;
+            assigned.push_back(data);
+            assigned = buffer;
+            if (copy.size() != 3 || copy[1] != nullptr || copy.releaseMode() != mode ||
+                assigned.releaseMode() != mode || CFGetRetainCount(data.get()) != 7) {
+                return false;
+            }
+
+            // Self-assignment changes nothing
+            auto &alias = assigned;
+            assigned = alias;
+            assigned = std::move(alias);
+            if (assigned.size() != 3 || CFGetRetainCount(data.get()) != 7) {
+                return false;
+            }
+
+            // Moves transfer the references; move assignment releases the objects it replaces
+            auto target = std::move(copy);
+            assigned = std::move(target);
+            if (assigned.size() != 3 || CFGetRetainCount(data.get()) != 5) {
+                if (mode == cf::ReleaseMode::immediate || !drainUntilRetainCount(data.get(), 5)) {
+                    return false;
+                }
+            }
+            copy.clear();
+            target.clear();
+        }
+        // Destruction releases every remaining object
+        if (mode == cf::ReleaseMode::immediate ? CFGetRetainCount(data.get()) != 1
+                                               : !drainUntilRetainCount(data.get(), 1)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,125 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "cf/Builders.hpp"
+#include "cf/Numbers.hpp"
+
+namespace {
+
+/// Creates a string distinct for each `index`.
+cf::CFString makeString(int index) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof buffer, "builder %d", index);
+    return cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, buffer, kCFStringEncodingUTF8));
+}
+
+/// A single-pass range of key-value pairs, whose iterators can be dereferenced once per position.
+class PairGenerator {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::pair<cf::CFString, cf::CFNumber>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        explicit iterator(int index) noexcept : index_{index} {}
+        value_type operator*() const { return {makeString(index_), cf::make_number(index_)}; }
+        iterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+        bool operator!=(const iterator &other) const noexcept { return index_ != other.index_; }
+
+      private:
+        int index_;
+    };
+
+    explicit PairGenerator(int count) noexcept : count_{count} {}
+    iterator begin() const noexcept { return iterator{0}; }
+    iterator end() const noexcept { return iterator{count_}; }
+
+  private:
+    int count_;
+};
+
+/// Returns true if `dictionary` maps `key` to a number equal to `value`.
+bool mapsTo(CFDictionaryRef _Nonnull dictionary, CFTypeRef _Nonnull key, int value) {
+    const auto number = cf::make_number(value);
+    const auto *found = CFDictionaryGetValue(dictionary, key);
+    return found != nullptr && CFEqual(found, number);
+}
+
+} /* namespace */
+
+bool cftest::makeArrayAndSet() {
+    // More elements than the inline capacity, in order
+    std::vector<cf::CFString> strings;
+    for (int i = 0; i < 3 * static_cast<int>(cf::detail::builderInlineCapacity); ++i) {
+        strings.push_back(makeString(i));
+    }
+    const auto array = cf::make_array(strings);
+    if (!array || CFArrayGetCount(array) != static_cast<CFIndex>(strings.size())) {
+        return false;
+    }
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+        if (CFArrayGetValueAtIndex(array, static_cast<CFIndex>(i)) != strings[i].get()) {
+            return false;
+        }
+    }
+
+    const auto empty = cf::make_array(std::vector<cf::CFString>{});
+    const auto listed = cf::make_array({strings[0].get(), strings[1].get(), strings[0].get()});
+    if (!empty || CFArrayGetCount(empty) != 0 || !listed || CFArrayGetCount(listed) != 3 ||
+        CFArrayGetValueAtIndex(listed, 2) != strings[0].get()) {
+        return false;
+    }
+
+    // Equal elements are stored once in a set
+    const auto copy = makeString(1);
+    const auto set = cf::make_set({strings[0].get(), strings[1].get(), copy.get()});
+    return set && CFSetGetCount(set) == 2 && CFSetContainsValue(set, strings[0]) && CFSetContainsValue(set, copy);
+}
+
+bool cftest::makeDictionaryPairs() {
+    // Pairs of CFRefs from a sized range and a single-pass range
+    std::vector<std::pair<cf::CFString, cf::CFNumber>> pairs;
+    for (int i = 0; i < 2 * static_cast<int>(cf::detail::builderInlineCapacity); ++i) {
+        pairs.emplace_back(makeString(i), cf::make_number(i));
+    }
+    const auto dictionary = cf::make_dictionary(pairs);
+    const auto generated = cf::make_dictionary(PairGenerator{static_cast<int>(pairs.size())});
+    if (!dictionary || !generated || CFDictionaryGetCount(dictionary) != static_cast<CFIndex>(pairs.size()) ||
+        !CFEqual(dictionary, generated)) {
+        return false;
+    }
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        if (!mapsTo(dictionary, pairs[i].first, static_cast<int>(i))) {
+            return false;
+        }
+    }
+
+    // The first pair for a duplicated key is kept
+    const auto key = makeString(0);
+    const auto equalKey = makeString(0);
+    const auto first = cf::make_number(1);
+    const auto second = cf::make_number(2);
+    const auto listed = cf::make_dictionary({{key.get(), first.get()}, {equalKey.get(), second.get()}});
+    std::vector<std::pair<cf::CFString, cf::CFNumber>> duplicates = {{key, second}, {equalKey, first}};
+    const auto ranged = cf::make_dictionary(duplicates);
+    return listed && CFDictionaryGetCount(listed) == 1 && mapsTo(listed, key, 1) && ranged &&
+           CFDictionaryGetCount(ranged) == 1 && mapsTo(ranged, equalKey, 2);
+}
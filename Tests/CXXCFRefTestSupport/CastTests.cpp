@@ -0,0 +1,61 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <utility>
+
+#include "cf/Cast.hpp"
+
+bool cftest::castTypeChecks() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    const auto string = cf::CFString::adopt(CFStringCreateWithCString(
+            kCFAllocatorDefault, "a string that is too long to be tagged", kCFStringEncodingUTF8));
+    if (!data || !string) {
+        return false;
+    }
+    CFTypeRef object = data.get();
+
+    // Mutable and immutable objects share a type identifier
+    if (!cf::isa<CFDataRef>(object) || !cf::isa<CFMutableDataRef>(object) || cf::isa<CFStringRef>(object) ||
+        !cf::isa<CFTypeRef>(object) || cf::isa<CFDataRef>(nullptr) || cf::isa<CFTypeRef>(nullptr)) {
+        return false;
+    }
+
+    return cf::dyn_cast<CFDataRef>(object) == data.get() && cf::dyn_cast<CFStringRef>(object) == nullptr &&
+           cf::dyn_cast<CFDataRef>(nullptr) == nullptr && cf::dyn_cast<CFStringRef>(string) == string.get() &&
+           cf::dyn_cast<CFNumberRef>(string) == nullptr;
+}
+
+bool cftest::castOwnership() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!data) {
+        return false;
+    }
+    CFTypeRef object = data.get();
+
+    // Casting a raw object or a CFRef shares ownership
+    {
+        const auto fromObject = cf::cast<cf::CFData>(object);
+        const auto fromRef = cf::cast<cf::CFData>(data);
+        if (fromObject.get() != data.get() || fromRef.get() != data.get() || CFGetRetainCount(object) != 3) {
+            return false;
+        }
+    }
+    if (CFGetRetainCount(object) != 1 || cf::cast<cf::CFString>(object) || cf::cast<cf::CFString>(data) ||
+        cf::cast<cf::CFData>(nullptr)) {
+        return false;
+    }
+
+    // Casting an rvalue CFRef transfers ownership on success and leaves the source unchanged on failure
+    auto source = cf::CFRef<CFTypeRef>::retain(object);
+    if (cf::cast<cf::CFString>(std::move(source)) || source.get() != object || CFGetRetainCount(object) != 2) {
+        return false;
+    }
+    const auto moved = cf::cast<cf::CFData>(std::move(source));
+    return moved.get() == data.get() && !source && CFGetRetainCount(object) == 2;
+}
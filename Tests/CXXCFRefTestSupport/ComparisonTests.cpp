@@ -0,0 +1,145 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#include "cf/CFRef.hpp"
+#include "cf/CFUniqueRef.hpp"
+#include "cf/ImmortalRef.hpp"
+#include "cf/RTRef.hpp"
+
+bool cftest::propertyListComparison() {
+    const auto string =
+            cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, "value", kCFStringEncodingUTF8));
+    const auto value = cf::CFPropertyList::retain(string.get());
+    const auto equal = cf::CFPropertyList::retain(CFSTR("value"));
+    const auto other = cf::CFPropertyList::retain(CFSTR("other"));
+    const cf::CFPropertyList null;
+
+    const auto unique = cf::CFUniquePropertyList::retain(string.get());
+    const cf::RTRef<CFPropertyListRef> realTime{value};
+    const cf::ImmortalRef<CFPropertyListRef> immortal{CFSTR("value")};
+
+    return value.isEqual(equal) && !value.isEqual(other) && !value.isEqual(null) && value.isEqual(CFSTR("value")) &&
+           value == equal && value != other && value == CFSTR("value") && null == nullptr &&
+           cf::EqualTo{}(value, equal) && cf::Hash{}(value) == cf::Hash{}(equal) && unique.isEqual(CFSTR("value")) &&
+           !unique.isEqual(other.get()) && realTime.isEqual(CFSTR("value")) && realTime.isEqual(cf::RTRef(equal)) &&
+           immortal.isEqual(value.get()) && !immortal.isEqual(other.get());
+}
+
+namespace {
+
+/// Detects whether `L < R` is well formed.
+template <typename L, typename R, typename = void> struct is_orderable : std::false_type {};
+
+template <typename L, typename R>
+struct is_orderable<L, R, std::void_t<decltype(std::declval<const L &>() < std::declval<const R &>())>>
+    : std::true_type {};
+
+static_assert(is_orderable<cf::CFString, cf::CFString>::value && is_orderable<cf::CFString, CFStringRef>::value &&
+                      is_orderable<CFStringRef, cf::CFString>::value &&
+                      is_orderable<cf::CFNumber, CFNumberRef>::value && is_orderable<CFDataRef, cf::CFData>::value,
+              "CFRefs of ordered types must be ordered against themselves and their raw objects");
+static_assert(!is_orderable<cf::CFString, cf::CFMutableString>::value &&
+                      !is_orderable<cf::CFNumber, cf::CFString>::value && !is_orderable<cf::CFData, cf::CFArray>::value,
+              "CFRefs of different types must not be ordered by address");
+
+/// Creates a string.
+cf::CFString makeString(const char *_Nonnull string) {
+    return cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, string, kCFStringEncodingUTF8));
+}
+
+/// Creates a data object.
+cf::CFData makeData(std::initializer_list<UInt8> bytes) {
+    return cf::CFData::adopt(CFDataCreate(kCFAllocatorDefault, bytes.size() != 0 ? bytes.begin() : nullptr,
+                                          static_cast<CFIndex>(bytes.size())));
+}
+
+/// Creates a number of `type`.
+template <typename V> cf::CFNumber makeNumber(CFNumberType type, V value) {
+    return cf::CFNumber::adopt(CFNumberCreate(kCFAllocatorDefault, type, &value));
+}
+
+} /* namespace */
+
+bool cftest::typedComparatorEquality() {
+    // Equal contents in distinct objects compare equal; a length mismatch is never equal
+    const auto abc = makeString("abc");
+    const auto otherABC = makeString("abc");
+    const auto abcd = makeString("abcd");
+    if (!abc || abc.get() == otherABC.get() || abc != otherABC || abc == abcd || abc.isEqual(abcd.get()) ||
+        abc != CFSTR("abc") || CFSTR("abc") != abc || abc == CFSTR("ab")) {
+        return false;
+    }
+
+    // Empty data compares equal even though its byte pointers may differ
+    const auto empty = makeData({});
+    const auto otherEmpty = makeData({});
+    const auto one = makeData({1});
+    const auto otherOne = makeData({1});
+    const auto two = makeData({1, 2});
+    if (!empty || empty != otherEmpty || empty == one || one != otherOne || one == two || two == one) {
+        return false;
+    }
+
+    // Numbers of different types compare by value
+    const auto integer = makeNumber<std::int32_t>(kCFNumberSInt32Type, 5);
+    const auto wide = makeNumber<std::int64_t>(kCFNumberSInt64Type, 5);
+    const auto real = makeNumber<double>(kCFNumberFloat64Type, 5.0);
+    const auto fraction = makeNumber<double>(kCFNumberFloat64Type, 5.5);
+    if (integer != wide || integer != real || integer == fraction || !integer.isEqual(real.get())) {
+        return false;
+    }
+
+    // Objects of another type are never equal, and null is only equal to null
+    const cf::CFString null;
+    return !abc.isEqual(integer.get()) && !integer.isEqual(abc.get()) && !one.isEqual(abc.get()) && abc != null &&
+           null == cf::CFString{} && abc == cf::CFRef<CFTypeRef>::retain(otherABC.get());
+}
+
+bool cftest::typedComparatorOrdering() {
+    const auto apple = makeString("apple");
+    const auto banana = makeString("banana");
+    const auto upper = makeString("APPLE");
+    const cf::CFString null;
+    if (!(apple < banana) || !(banana > apple) || !(apple <= makeString("apple")) || !(apple >= makeString("apple")) ||
+        banana < apple || !(null < apple) || apple < null || apple.compare(upper) == kCFCompareEqualTo ||
+        apple.compare(upper, kCFCompareCaseInsensitive) != kCFCompareEqualTo) {
+        return false;
+    }
+
+    // Raw objects are ordered by contents on either side
+    if (!(apple < CFSTR("banana")) || !(CFSTR("banana") > apple) || !(apple <= CFSTR("apple")) ||
+        !(CFSTR("apple") >= apple) || apple > CFSTR("banana") || !(CFSTR("aardvark") < apple) ||
+        !(static_cast<CFStringRef>(nullptr) < apple)) {
+        return false;
+    }
+
+    // Data orders by length and then by bytes
+    const auto empty = makeData({});
+    const auto high = makeData({0xff});
+    const auto low = makeData({0x00, 0x00});
+    const auto lowLarger = makeData({0x00, 0x01});
+    if (!(empty < high) || !(high < low) || !(low < lowLarger) || !(lowLarger > low) ||
+        empty.compare(makeData({})) != kCFCompareEqualTo || !(low <= makeData({0x00, 0x00}))) {
+        return false;
+    }
+
+    // Numbers order by value across types
+    const auto integer = makeNumber<std::int32_t>(kCFNumberSInt32Type, 5);
+    const auto fraction = makeNumber<double>(kCFNumberFloat64Type, 5.5);
+    const auto negative = makeNumber<std::int8_t>(kCFNumberSInt8Type, -3);
+    const auto large = makeNumber<std::int64_t>(kCFNumberSInt64Type, std::int64_t{1} << 40);
+    return integer < fraction && negative < integer && fraction < large && large > negative &&
+           integer.compare(makeNumber<float>(kCFNumberFloat32Type, 5.0f)) == kCFCompareEqualTo &&
+           integer <= static_cast<CFNumberRef>(fraction.get()) && static_cast<CFNumberRef>(large.get()) >= fraction;
+}
@@ -0,0 +1,85 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "cf/Data.hpp"
+
+namespace {
+
+/// The storage whose deallocations are counted, or null.
+std::atomic<const void *> trackedStorage{nullptr};
+/// The number of times `trackedStorage` has been passed to operator delete.
+std::atomic<int> trackedDeletes{0};
+
+/// Counts a deallocation if it is of the tracked storage.
+void countDelete(const void *_Nullable ptr) noexcept {
+    if (ptr != nullptr && ptr == trackedStorage.load()) {
+        ++trackedDeletes;
+    }
+}
+
+/// Creates a CFData from a vector and checks that its storage is adopted and freed exactly once on release.
+bool adoptsAndFreesOnce(std::size_t size) {
+    std::vector<std::uint8_t> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::uint8_t>(i * 7);
+    }
+    const auto expected = bytes;
+    const auto *storage = bytes.data();
+    trackedStorage = storage;
+    trackedDeletes = 0;
+
+    bool adopted;
+    {
+        const auto data = cf::data_from(std::move(bytes));
+        adopted = data && bytes.empty() && CFDataGetBytePtr(data) == storage &&
+                  cf::to_vector(data) == expected && trackedDeletes == 0;
+    }
+    const auto deletes = trackedDeletes.load();
+    trackedStorage = nullptr;
+    return adopted && deletes == 1;
+}
+
+} /* namespace */
+
+// Global allocation functions that count deallocations of the storage being tracked
+
+void *operator new(std::size_t size) {
+    if (void *ptr = std::malloc(size != 0 ? size : 1); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    countDelete(ptr);
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept {
+    countDelete(ptr);
+    std::free(ptr);
+}
+
+bool cftest::dataFromVectorFreesOnce() {
+    if (!adoptsAndFreesOnce(1) || !adoptsAndFreesOnce(4096)) {
+        return false;
+    }
+
+    // An empty vector produces an empty CFData without transferring storage
+    std::vector<std::uint8_t> empty;
+    const auto data = cf::data_from(std::move(empty));
+    return data && CFDataGetLength(data) == 0;
+}
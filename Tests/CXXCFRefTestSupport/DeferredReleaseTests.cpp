@@ -0,0 +1,114 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include "cf/CFRef.hpp"
+#include "cf/DeferredRelease.hpp"
+#include "cf/RTRef.hpp"
+
+namespace {
+
+/// An interval long enough that a queue's drain thread never runs during a check.
+constexpr std::chrono::hours idleInterval{1};
+
+/// Waits up to one second for an object's retain count to reach `count`.
+bool waitForRetainCount(CFTypeRef _Nonnull object, CFIndex count) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+    while (CFGetRetainCount(object) != count) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+} /* namespace */
+
+bool cftest::deferredReleaseBalancesRetains() {
+    // Mutable data is never a tagged pointer, so its retain count is meaningful
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    cf::DeferredRelease queue{64, idleInterval};
+
+    constexpr CFIndex count = 10;
+    for (CFIndex i = 0; i < count; ++i) {
+        queue.release(CFRetain(data.get()));
+    }
+    queue.release(nullptr);
+    if (CFGetRetainCount(data.get()) != count + 1) {
+        return false;
+    }
+
+    return queue.drain() == count && CFGetRetainCount(data.get()) == 1 && queue.drain() == 0 &&
+           queue.overflowCount() == 0;
+}
+
+bool cftest::deferredReleaseOverflow() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    cf::DeferredRelease queue{4, idleInterval};
+
+    // Objects released once the queue is full are released immediately
+    for (int i = 0; i < 6; ++i) {
+        queue.release(CFRetain(data.get()));
+    }
+    if (queue.overflowCount() != 2 || CFGetRetainCount(data.get()) != 5) {
+        return false;
+    }
+
+    CFRetain(data.get());
+    if (queue.tryEnqueue(data.get())) {
+        return false;
+    }
+    CFRelease(data.get());
+
+    if (queue.drain() != 4 || CFGetRetainCount(data.get()) != 1) {
+        return false;
+    }
+
+    // Draining frees every slot
+    for (int i = 0; i < 4; ++i) {
+        if (!queue.tryEnqueue(CFRetain(data.get()))) {
+            return false;
+        }
+    }
+    return queue.drain() == 4 && CFGetRetainCount(data.get()) == 1 && queue.overflowCount() == 2;
+}
+
+bool cftest::deferredReleaseOnDestruction() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    {
+        cf::DeferredRelease queue{16, idleInterval};
+        for (int i = 0; i < 8; ++i) {
+            queue.release(CFRetain(data.get()));
+        }
+    }
+    return CFGetRetainCount(data.get()) == 1;
+}
+
+bool cftest::rtRefRetainReleaseBalance() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    static_cast<void>(cf::DeferredRelease::shared());
+    {
+        auto ref = cf::RTRef<CFMutableDataRef>::retain(data.get());
+        auto copy = ref;
+        cf::RTRef<CFMutableDataRef> assigned;
+        assigned = copy;
+        auto moved = std::move(copy);
+        cf::RTRef<CFMutableDataRef> shared{data};
+        if (CFGetRetainCount(data.get()) != 5) {
+            return false;
+        }
+        ref.reset();
+        assigned = nullptr;
+    }
+    return waitForRetainCount(data.get(), 1);
+}
@@ -0,0 +1,121 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "cf/DictionaryView.hpp"
+#include "cf/Numbers.hpp"
+
+namespace {
+
+using NumberView = cf::DictionaryView<CFNumberRef, CFNumberRef>;
+
+// Views borrow the dictionary, so they cannot be made from a temporary that would release it
+static_assert(std::is_constructible_v<NumberView, const cf::CFDictionary &>);
+static_assert(!std::is_constructible_v<NumberView, cf::CFDictionary &&>);
+
+/// The number of pairs in the test dictionary, more than fit in the view's inline storage.
+constexpr int pairCount = static_cast<int>(NumberView::inlineCapacity) + 8;
+
+/// Creates a dictionary mapping the numbers `[0, pairCount)` to ten times their value.
+cf::CFMutableDictionary makeDictionary() {
+    auto dictionary = cf::CFMutableDictionary::adopt(CFDictionaryCreateMutable(
+            kCFAllocatorDefault, 0, &kCFTypeDictionaryKeyCallBacks, &kCFTypeDictionaryValueCallBacks));
+    if (!dictionary) {
+        return {};
+    }
+    for (int i = 0; i < pairCount; ++i) {
+        const auto key = cf::make_number(i);
+        const auto value = cf::make_number(10 * i);
+        CFDictionarySetValue(dictionary, key.get(), value.get());
+    }
+    return dictionary;
+}
+
+/// Returns the value of a number.
+std::int64_t valueOf(CFNumberRef _Nonnull number) noexcept {
+    std::int64_t value = 0;
+    CFNumberGetValue(number, kCFNumberSInt64Type, &value);
+    return value;
+}
+
+} /* namespace */
+
+bool cftest::dictionaryViewPairs() {
+    const auto dictionary = makeDictionary();
+    const NumberView view{dictionary};
+    if (!dictionary || view.size() != static_cast<std::size_t>(pairCount) || view.empty() ||
+        view.dictionary() != dictionary.get()) {
+        return false;
+    }
+
+    // Every key appears once and is paired with its value in the dictionary
+    std::vector<bool> seen(static_cast<std::size_t>(pairCount));
+    for (const auto [key, value] : view) {
+        const auto index = valueOf(key);
+        if (index < 0 || index >= pairCount || seen[static_cast<std::size_t>(index)] || valueOf(value) != 10 * index ||
+            value != CFDictionaryGetValue(dictionary, key)) {
+            return false;
+        }
+        seen[static_cast<std::size_t>(index)] = true;
+    }
+
+    // Indexed access and iterator arithmetic agree with iteration order
+    auto it = view.begin();
+    for (std::size_t i = 0; i < view.size(); ++i, ++it) {
+        if ((*it).first != view.key(i) || (*it).second != view.value(i) || view[i] != *it ||
+            view.begin()[static_cast<std::ptrdiff_t>(i)] != *it) {
+            return false;
+        }
+    }
+    return it == view.end() && view.end() - view.begin() == pairCount && view.end() - 1 > view.begin();
+}
+
+bool cftest::dictionaryViewLookup() {
+    const auto dictionary = makeDictionary();
+    const NumberView view{dictionary};
+    const auto present = cf::make_number(3);
+    const auto missing = cf::make_number(pairCount);
+    if (!dictionary || !present || !missing) {
+        return false;
+    }
+
+    const auto found = view.find(present.get());
+    if (!view.contains(present.get()) || !found || valueOf(found) != 30 || view.contains(missing.get()) ||
+        view.find(missing.get()) != nullptr) {
+        return false;
+    }
+
+    // Neither the values nor the dictionary are retained by a view
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    const void *keys[] = {present.get()};
+    const void *values[] = {data.get()};
+    const auto single = cf::CFDictionary::adopt(CFDictionaryCreate(kCFAllocatorDefault, keys, values, 1,
+                                                                   &kCFTypeDictionaryKeyCallBacks,
+                                                                   &kCFTypeDictionaryValueCallBacks));
+    if (!data || !single || CFGetRetainCount(data.get()) != 2) {
+        return false;
+    }
+    {
+        const cf::DictionaryView<CFNumberRef, CFMutableDataRef> dataView{single};
+        if (dataView.value(0) != data.get() || dataView.find(present.get()) != data.get() ||
+            CFGetRetainCount(data.get()) != 2 || CFGetRetainCount(single.get()) != 1) {
+            return false;
+        }
+    }
+
+    // Empty and null dictionaries have empty views
+    const NumberView empty{};
+    const NumberView null{static_cast<CFDictionaryRef>(nullptr)};
+    return CFGetRetainCount(data.get()) == 2 && empty.empty() && empty.begin() == empty.end() && null.empty() &&
+           !null.contains(present.get()) && null.find(present.get()) == nullptr;
+}
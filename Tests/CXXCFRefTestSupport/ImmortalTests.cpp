@@ -0,0 +1,42 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <utility>
+
+#include "cf/CFRefCore.hpp"
+
+namespace {
+
+/// Copies, assigns, moves and leaks CFRefs to `object` and checks that its retain count never changes.
+template <typename T> bool leavesRetainCountUnchanged(T _Nonnull object) {
+    const auto before = CFGetRetainCount(object);
+    {
+        const auto ref = cf::CFRef<T>::retain(object);
+        auto copy = ref;
+        cf::CFRef<T> assigned;
+        assigned = copy;
+        auto moved = std::move(copy);
+        if (CFGetRetainCount(object) != before || assigned.get() != object || moved.get() != object) {
+            return false;
+        }
+        // No reference was taken, so none is transferred
+        auto leaked = cf::CFRef<T>::retain(object);
+        if (leaked.leak() != object || CFGetRetainCount(object) != before) {
+            return false;
+        }
+    }
+    return CFGetRetainCount(object) == before;
+}
+
+} /* namespace */
+
+bool cftest::immortalTypesSkipRetainCounts() {
+    return leavesRetainCountUnchanged(kCFBooleanTrue) && leavesRetainCountUnchanged(kCFBooleanFalse) &&
+           leavesRetainCountUnchanged(kCFNull);
+}
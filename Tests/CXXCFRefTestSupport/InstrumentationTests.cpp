@@ -0,0 +1,84 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <utility>
+
+#include "cf/CFRefCollections.hpp"
+#include "cf/CFRefCore.hpp"
+#include "cf/Instrumentation.hpp"
+
+#if CXXCFREF_INSTRUMENTATION
+
+#include <optional>
+#include <string_view>
+
+namespace {
+
+/// Returns the counts for CFMutableBitVector.
+///
+/// No other test uses the type, so its counts are not disturbed by tests running concurrently.
+std::optional<cf::instrumentation::TypeStatistics> bitVectorStatistics() {
+    for (auto &statistics : cf::instrumentation::snapshot()) {
+        const std::string_view name{statistics.typeName};
+        if (name.find("__CFBitVector") != std::string_view::npos && name.find("const") == std::string_view::npos) {
+            return std::move(statistics);
+        }
+    }
+    return std::nullopt;
+}
+
+} /* namespace */
+
+bool cftest::instrumentationCounters() {
+    using BitVector = cf::CFRef<CFMutableBitVectorRef>;
+
+    cf::instrumentation::reset();
+    {
+        auto adopted = BitVector::adopt(CFBitVectorCreateMutable(kCFAllocatorDefault, 0));
+        if (!adopted) {
+            return false;
+        }
+        const auto retained = BitVector::retain(adopted.get());
+        auto copied = adopted;
+        auto moved = std::move(copied);
+        moved = retained;
+        CFRelease(BitVector{std::move(moved)}.leak());
+    }
+
+    // Immortal types are never counted
+    const auto boolean = cf::CFBoolean::retain(kCFBooleanTrue);
+
+    const auto statistics = bitVectorStatistics();
+    if (!statistics || statistics->adopts != 1 || statistics->retains != 3 || statistics->copies != 2 ||
+        statistics->moves != 2 || statistics->leaks != 1 || statistics->releases != 3 || statistics->live != 0) {
+        return false;
+    }
+    for (const auto &other : cf::instrumentation::snapshot()) {
+        if (std::string_view{other.typeName}.find("__CFBoolean") != std::string_view::npos) {
+            return false;
+        }
+    }
+
+    cf::instrumentation::reset();
+    const auto cleared = bitVectorStatistics();
+    return cleared && cleared->adopts == 0 && cleared->retains == 0 && cleared->releases == 0 && cleared->leaks == 0;
+}
+
+#else
+
+bool cftest::instrumentationCounters() {
+    // Without CXXCFREF_INSTRUMENTATION the hooks compile to nothing and CFRef holds only its pointer
+    static_assert(sizeof(cf::CFRef<CFMutableBitVectorRef>) == sizeof(CFMutableBitVectorRef));
+    auto adopted = cf::CFRef<CFMutableBitVectorRef>::adopt(CFBitVectorCreateMutable(kCFAllocatorDefault, 0));
+    const auto copied = adopted;
+    const auto moved = std::move(adopted);
+    return moved && moved.get() == copied.get() && CFGetRetainCount(moved.get()) == 2;
+}
+
+#endif /* CXXCFREF_INSTRUMENTATION */
@@ -0,0 +1,131 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "cf/CFRef.hpp"
+#include "cf/InternTable.hpp"
+
+namespace {
+
+/// Creates a new CFString for `index`, long enough that it is never a tagged pointer.
+cf::CFString makeString(int index) {
+    char buffer[64];
+    std::snprintf(buffer, sizeof buffer, "an interned string long enough to be heap allocated %d", index);
+    return cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, buffer, kCFStringEncodingUTF8));
+}
+
+} /* namespace */
+
+bool cftest::internTableCanonicalInstances() {
+    const auto first = makeString(1);
+    const auto equal = makeString(1);
+    const auto other = makeString(2);
+    if (first.get() == equal.get()) {
+        return false;
+    }
+
+    cf::InternTable<CFStringRef> table{4};
+    if (table.intern(nullptr) || table.find(nullptr) || table.find(first)) {
+        return false;
+    }
+
+    // An immutable string is its own canonical instance, and equal strings map to it
+    const auto canonical = table.intern(first);
+    const auto internedEqual = table.intern(equal);
+    const auto foundEqual = table.find(equal);
+    const auto internedOther = table.intern(other);
+    if (canonical.get() != first.get() || internedEqual.get() != first.get() || foundEqual.get() != first.get() ||
+        internedOther.get() != other.get() || table.size() != 2) {
+        return false;
+    }
+
+    // A mutable string is copied, so changing it afterward does not affect its canonical instance
+    const auto original = makeString(3);
+    const auto mutableString = cf::CFMutableString::adopt(CFStringCreateMutableCopy(kCFAllocatorDefault, 0, original));
+    const auto copy = table.intern(mutableString.get());
+    if (!copy || static_cast<CFTypeRef>(copy.get()) == static_cast<CFTypeRef>(mutableString.get())) {
+        return false;
+    }
+    CFStringAppendCString(mutableString, " and then changed", kCFStringEncodingUTF8);
+    const auto foundOriginal = table.find(original);
+    return foundOriginal.get() == copy.get() && !table.find(mutableString.get()) && table.size() == 3;
+}
+
+bool cftest::internTableEviction() {
+    const auto first = makeString(1);
+    cf::InternTable<CFStringRef> table;
+    {
+        // The table, `first` and `held` each hold a reference
+        const auto held = table.intern(first);
+        if (held.get() != first.get() || CFGetRetainCount(first.get()) != 3) {
+            return false;
+        }
+        if (table.evictUnused() != 0) {
+            return false;
+        }
+    }
+
+    // An instance referenced outside the table survives eviction
+    if (table.evictUnused() != 0 || CFGetRetainCount(first.get()) != 2) {
+        return false;
+    }
+
+    // An instance whose only reference is the table's is evicted
+    {
+        const auto transient = makeString(2);
+        static_cast<void>(table.intern(transient));
+    }
+    if (table.size() != 2 || table.evictUnused() != 1 || table.size() != 1) {
+        return false;
+    }
+    const auto evicted = makeString(2);
+    if (table.find(evicted)) {
+        return false;
+    }
+
+    table.clear();
+    return table.size() == 0 && CFGetRetainCount(first.get()) == 1;
+}
+
+bool cftest::internTableConcurrentInterning() {
+    constexpr int stringCount = 32;
+    constexpr int threadCount = 4;
+    constexpr int iterations = 2000;
+
+    cf::InternTable<CFStringRef> table{4};
+    std::array<std::atomic<CFStringRef>, stringCount> canonical{};
+    std::atomic<bool> passed{true};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < iterations; ++j) {
+                const auto index = (i + j) % stringCount;
+                // Each thread interns its own equal strings, and all must agree on the canonical instance
+                const auto interned = table.intern(makeString(index));
+                CFStringRef expected = nullptr;
+                if (!interned ||
+                    (!canonical[static_cast<std::size_t>(index)].compare_exchange_strong(expected, interned.get()) &&
+                     expected != interned.get())) {
+                    passed = false;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    return passed && table.size() == stringCount && table.evictUnused() == stringCount && table.size() == 0;
+}
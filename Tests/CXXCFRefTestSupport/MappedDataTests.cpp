@@ -0,0 +1,99 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include <unistd.h>
+
+#include "TemporaryFile.hpp"
+#include "cf/MappedData.hpp"
+
+namespace {
+
+/// Returns true if `error` is a POSIX-domain error with `code`, and releases it.
+bool isPOSIXError(CFErrorRef _Nullable error, int code) noexcept {
+    if (error == nullptr) {
+        return false;
+    }
+    const auto matches = CFEqual(CFErrorGetDomain(error), kCFErrorDomainPOSIX) && CFErrorGetCode(error) == code;
+    CFRelease(error);
+    return matches;
+}
+
+/// Returns true if the bytes of `data` are `string`.
+bool hasContents(CFDataRef _Nullable data, const char *string) noexcept {
+    const auto length = std::strlen(string);
+    return data != nullptr && static_cast<std::size_t>(CFDataGetLength(data)) == length &&
+           std::memcmp(CFDataGetBytePtr(data), string, length) == 0;
+}
+
+/// Returns true if the file open as `fd` contains `string`.
+bool fileContains(int fd, const char *string) noexcept {
+    char buffer[64] = {};
+    const auto length = std::strlen(string);
+    return ::pread(fd, buffer, sizeof buffer, 0) == static_cast<ssize_t>(length) &&
+           std::memcmp(buffer, string, length) == 0;
+}
+
+} /* namespace */
+
+bool cftest::mappedDataEmptyAndMissingFiles() {
+    // An empty file cannot be mapped, so it produces an empty CFData
+    TemporaryFile empty;
+    if (!empty) {
+        return false;
+    }
+    CFErrorRef error = nullptr;
+    const auto data = cf::mapped_data(empty.path(), cf::MapOptions::none, &error);
+    if (!data || CFDataGetLength(data) != 0 || error != nullptr) {
+        return false;
+    }
+
+    // A missing file reports the error from open
+    const std::string missing = empty.path() + std::string{".missing"};
+    if (cf::mapped_data(missing.c_str(), cf::MapOptions::none, &error) || !isPOSIXError(error, ENOENT)) {
+        return false;
+    }
+
+    // A directory is rejected
+    const std::string path = empty.path();
+    const std::string directory = path.substr(0, path.rfind('/') + 1);
+    error = nullptr;
+    return !cf::mapped_data(directory.c_str(), cf::MapOptions::none, &error) && isPOSIXError(error, EISDIR);
+}
+
+bool cftest::mappedDataCopyOnWrite() {
+    TemporaryFile file;
+    if (!file || !file.write("mapped contents", 15)) {
+        return false;
+    }
+
+    const auto readOnly = cf::mapped_data(file.path(), cf::MapOptions::sequential | cf::MapOptions::willNeed);
+    if (!hasContents(readOnly, "mapped contents")) {
+        return false;
+    }
+
+    // Modifications to a copy-on-write mapping are private to it
+    const auto copy = cf::mapped_data(file.path(), cf::MapOptions::copyOnWrite);
+    if (!hasContents(copy, "mapped contents")) {
+        return false;
+    }
+    std::memcpy(const_cast<UInt8 *>(CFDataGetBytePtr(copy)), "copied", 6);
+    if (!hasContents(copy, "copied contents") || !hasContents(readOnly, "mapped contents") ||
+        !fileContains(file.fd(), "mapped contents")) {
+        return false;
+    }
+
+    // A new mapping still sees the file's contents
+    const auto again = cf::mapped_data(file.path());
+    return hasContents(again, "mapped contents");
+}
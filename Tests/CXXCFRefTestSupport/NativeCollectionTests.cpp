@@ -0,0 +1,168 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <set>
+#include <string>
+
+#include "cf/NativeCollections.hpp"
+
+namespace {
+
+/// A value stored on the heap that records each live instance, so double destruction and leaks can be detected.
+struct Counted final {
+    /// The live instances.
+    static std::set<const Counted *> &live() {
+        static std::set<const Counted *> instances;
+        return instances;
+    }
+
+    /// The number of instances destroyed that were not live.
+    static std::size_t &invalidDestructions() {
+        static std::size_t count = 0;
+        return count;
+    }
+
+    explicit Counted(int v) : value{v} { live().insert(this); }
+    Counted(const Counted &other) : value{other.value} { live().insert(this); }
+    Counted &operator=(const Counted &) = delete;
+    ~Counted() {
+        if (live().erase(this) != 1) {
+            ++invalidDestructions();
+        }
+    }
+
+    bool operator==(const Counted &other) const noexcept { return value == other.value; }
+    bool operator<(const Counted &other) const noexcept { return value < other.value; }
+
+    int value;
+    /// Padding so `Counted` is never stored inline.
+    char padding[sizeof(void *)] = {};
+};
+
+} /* namespace */
+
+template <> struct std::hash<Counted> {
+    std::size_t operator()(const Counted &counted) const noexcept { return std::hash<int>{}(counted.value); }
+};
+
+bool cftest::nativeCollectionHeapCopies() {
+    static_assert(!cf::NativeCallBacks<Counted>::isInline, "Counted must be stored on the heap");
+    {
+        // Each collection holds its own copies, which are independent of the caller's values
+        cf::NativeArray<Counted> array;
+        cf::NativeDictionary<Counted, Counted> dictionary;
+        cf::NativeBinaryHeap<Counted> heap;
+        {
+            const Counted one{1};
+            const Counted two{2};
+            array.push_back(one);
+            array.push_back(two);
+            array.set(0, two);
+            array.set(2, one);
+            dictionary.set(one, two);
+            dictionary.set(one, one);
+            dictionary.set(two, two);
+            heap.push(two);
+            heap.push(one);
+        }
+        // One array element was replaced and one dictionary value was replaced, so 3 + 4 + 2 copies remain
+        if (Counted::live().size() != 9 || array.size() != 3 || array[0].value != 2 || array[2].value != 1) {
+            return false;
+        }
+        if (const auto value = dictionary.find(Counted{1});
+            !value || value->value != 1 || dictionary.size() != 2 || heap.top().value != 1) {
+            return false;
+        }
+
+        dictionary.erase(Counted{2});
+        heap.pop();
+        if (Counted::live().size() != 6 || dictionary.contains(Counted{2})) {
+            return false;
+        }
+        array.clear();
+        if (Counted::live().size() != 3) {
+            return false;
+        }
+    }
+    return Counted::live().empty() && Counted::invalidDestructions() == 0;
+}
+
+bool cftest::nativeCollectionInlineEncoding() {
+    static_assert(cf::NativeCallBacks<int>::isInline && cf::NativeCallBacks<float>::isInline,
+                  "Small trivially copyable values must be stored inline");
+
+    cf::NativeArray<int> integers;
+    for (const int value : {0, -1, INT_MIN, INT_MAX, 42}) {
+        integers.push_back(value);
+    }
+    if (integers.size() != 5 || integers[0] != 0 || integers[1] != -1 || integers[2] != INT_MIN ||
+        integers[3] != INT_MAX || integers[4] != 42) {
+        return false;
+    }
+
+    cf::NativeArray<float> floats;
+    floats.push_back(0.0f);
+    floats.push_back(-0.0f);
+    floats.push_back(-1.5f);
+    floats.push_back(std::numeric_limits<float>::quiet_NaN());
+    floats.push_back(std::numeric_limits<float>::infinity());
+    return floats.size() == 5 && floats[0] == 0.0f && !std::signbit(floats[0]) && floats[1] == 0.0f &&
+           std::signbit(floats[1]) && floats[2] == -1.5f && std::isnan(floats[3]) && std::isinf(floats[4]);
+}
+
+bool cftest::nativeDictionaryNullEncodedValue() {
+    // Zero is encoded as a null pointer, which must still be distinguishable from a missing key
+    cf::NativeDictionary<int, int> dictionary;
+    dictionary.set(7, 0);
+    dictionary.set(8, -1);
+    const auto zero = dictionary.find(7);
+    const auto negative = dictionary.find(8);
+    const auto missing = dictionary.find(9);
+    if (!zero || *zero != 0 || !negative || *negative != -1 || missing || !dictionary.contains(7)) {
+        return false;
+    }
+
+    cf::NativeDictionary<std::string, int> strings;
+    strings.set("zero", 0);
+    const auto found = strings.find("zero");
+    return found && *found == 0 && !strings.find("one") && strings.size() == 1;
+}
+
+bool cftest::nativeBinaryHeapOrdering() {
+    cf::NativeBinaryHeap<int> integers;
+    for (const int value : {5, -3, 12, 0, -3, 7, INT_MIN, 1}) {
+        integers.push(value);
+    }
+    for (const int expected : {INT_MIN, -3, -3, 0, 1, 5, 7, 12}) {
+        if (integers.empty() || integers.top() != expected) {
+            return false;
+        }
+        integers.pop();
+    }
+    if (!integers.empty()) {
+        return false;
+    }
+
+    cf::NativeBinaryHeap<std::string> strings;
+    for (const char *value : {"pear", "apple", "fig", "banana"}) {
+        strings.push(value);
+    }
+    for (const char *expected : {"apple", "banana", "fig", "pear"}) {
+        if (strings.empty() || strings.top() != expected) {
+            return false;
+        }
+        strings.pop();
+    }
+    return strings.empty();
+}
@@ -0,0 +1,79 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include "cf/Numbers.hpp"
+
+namespace {
+
+/// Creates a CFNumber of `type` holding `value`.
+template <typename T> cf::CFNumber createNumber(CFNumberType type, T value) {
+    return cf::CFNumber::adopt(CFNumberCreate(kCFAllocatorDefault, type, &value));
+}
+
+/// Returns true if `number` is non-null, has `type`, and holds `value`.
+template <typename T> bool holds(const cf::CFNumber &number, CFNumberType type, T value) {
+    return number && CFNumberGetType(number) == type && cf::number_cast<T>(number) == value;
+}
+
+} /* namespace */
+
+bool cftest::numberCastRejectsLossyValues() {
+    const auto fraction = createNumber<double>(kCFNumberFloat64Type, 3.5);
+    const auto whole = createNumber<double>(kCFNumberFloat64Type, 5.0);
+    if (cf::number_cast<int>(fraction) || cf::number_cast<std::int64_t>(fraction) ||
+        cf::number_cast<double>(fraction) != 3.5 || cf::number_cast<int>(whole) != 5) {
+        return false;
+    }
+
+    const auto large = createNumber<std::int64_t>(kCFNumberSInt64Type, 300);
+    const auto negative = createNumber<std::int32_t>(kCFNumberSInt32Type, -1);
+    const auto maximum = createNumber<std::int64_t>(kCFNumberSInt64Type, std::numeric_limits<std::int64_t>::max());
+    return !cf::number_cast<std::int8_t>(large) && !cf::number_cast<std::uint8_t>(large) &&
+           cf::number_cast<std::int16_t>(large) == 300 && cf::number_cast<std::uint16_t>(large) == 300 &&
+           !cf::number_cast<std::uint32_t>(negative) && !cf::number_cast<std::uint64_t>(negative) &&
+           cf::number_cast<std::int8_t>(negative) == -1 && !cf::number_cast<std::int32_t>(maximum) &&
+           cf::number_cast<std::int64_t>(maximum) == std::numeric_limits<std::int64_t>::max() &&
+           cf::number_cast<std::uint64_t>(maximum) == std::numeric_limits<std::uint64_t>::max() / 2 &&
+           !cf::number_cast<int>(nullptr);
+}
+
+bool cftest::makeNumberTypes() {
+    // Cached and created numbers have the CFNumberType for `T`
+    if (!holds(cf::make_number<std::int8_t>(5), kCFNumberSInt8Type, std::int8_t{5}) ||
+        !holds(cf::make_number<std::int16_t>(5), kCFNumberSInt16Type, std::int16_t{5}) ||
+        !holds(cf::make_number<std::int32_t>(5), kCFNumberSInt32Type, std::int32_t{5}) ||
+        !holds(cf::make_number<std::int32_t>(5000), kCFNumberSInt32Type, std::int32_t{5000}) ||
+        !holds(cf::make_number<std::int64_t>(5), kCFNumberSInt64Type, std::int64_t{5}) ||
+        !holds(cf::make_number<std::int32_t>(44100), kCFNumberSInt32Type, std::int32_t{44100}) ||
+        !holds(cf::make_number<std::uint8_t>(200), kCFNumberSInt16Type, std::uint8_t{200}) ||
+        !holds(cf::make_number<std::uint32_t>(4000000000u), kCFNumberSInt64Type, std::uint32_t{4000000000u}) ||
+        !holds(cf::make_number<double>(0.25), kCFNumberFloat64Type, 0.25) ||
+        !holds(cf::make_number<float>(0.5f), kCFNumberFloat32Type, 0.5f)) {
+        return false;
+    }
+    // An unsigned 64-bit value above INT64_MAX cannot be represented
+    return !cf::make_number(std::numeric_limits<std::uint64_t>::max());
+}
+
+bool cftest::makeNumberCache() {
+    // A cached value is the same object each time for a given type, and a different object for another type
+    const auto first = cf::make_number<std::int32_t>(-7);
+    const auto second = cf::make_number<std::int32_t>(-7);
+    const auto wide = cf::make_number<std::int64_t>(-7);
+    const auto rate = cf::make_number<std::int32_t>(48000);
+    const auto sameRate = cf::make_number<std::int32_t>(48000);
+    return first && first.get() == second.get() && wide && wide.get() != first.get() &&
+           CFNumberGetType(wide) == kCFNumberSInt64Type && rate && rate.get() == sameRate.get() &&
+           first.get() == cf::detail::cachedNumber(-7, kCFNumberSInt32Type) &&
+           !cf::detail::cachedNumber(5000, kCFNumberSInt32Type) &&
+           !cf::detail::cachedNumber(cf::numberCacheMin - 1, kCFNumberSInt64Type);
+}
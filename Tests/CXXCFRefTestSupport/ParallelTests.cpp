@@ -0,0 +1,88 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "cf/Builders.hpp"
+#include "cf/Numbers.hpp"
+#include "cf/Parallel.hpp"
+
+namespace {
+
+/// The number of elements, enough to be split into several chunks.
+constexpr int elementCount = 1000;
+
+/// Creates an array of the numbers `[0, elementCount)`.
+cf::CFArray makeNumbers() {
+    std::vector<cf::CFNumber> numbers;
+    for (int i = 0; i < elementCount; ++i) {
+        numbers.push_back(cf::make_number(i));
+    }
+    return cf::make_array(numbers);
+}
+
+/// Returns the value of a number.
+std::int64_t valueOf(CFNumberRef _Nonnull number) noexcept {
+    std::int64_t value = 0;
+    CFNumberGetValue(number, kCFNumberSInt64Type, &value);
+    return value;
+}
+
+} /* namespace */
+
+bool cftest::parallelTransformResults() {
+    const auto numbers = makeNumbers();
+    const auto doubled = cf::parallel_transform<CFNumberRef>(
+            numbers, [](CFNumberRef number) { return cf::make_number(2 * valueOf(number)); });
+    if (!doubled || CFArrayGetCount(doubled) != elementCount) {
+        return false;
+    }
+    for (CFIndex i = 0; i < elementCount; ++i) {
+        if (valueOf(static_cast<CFNumberRef>(CFArrayGetValueAtIndex(doubled, i))) != 2 * i) {
+            return false;
+        }
+    }
+
+    const auto empty = cf::parallel_transform(cf::make_array(std::vector<cf::CFNumber>{}),
+                                              [](CFTypeRef object) { return cf::CFRef<CFTypeRef>::retain(object); });
+    return empty && CFArrayGetCount(empty) == 0 &&
+           !cf::parallel_transform(nullptr, [](CFTypeRef object) { return cf::CFRef<CFTypeRef>::retain(object); });
+}
+
+bool cftest::parallelTransformFailures() {
+    const auto numbers = makeNumbers();
+    const auto shared = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!numbers || !shared) {
+        return false;
+    }
+
+    // A null result fails the transform and the other results are released
+    const auto withNull = cf::parallel_transform<CFNumberRef>(numbers, [&](CFNumberRef number) {
+        return valueOf(number) == elementCount / 2 ? cf::CFMutableData{} : shared;
+    });
+    if (withNull || CFGetRetainCount(shared.get()) != 1) {
+        return false;
+    }
+
+    // An exception is rethrown and the results produced before it are released
+    bool thrown = false;
+    try {
+        static_cast<void>(cf::parallel_transform<CFNumberRef>(numbers, [&](CFNumberRef number) {
+            if (valueOf(number) == elementCount - 1) {
+                throw std::runtime_error("transform failed");
+            }
+            return shared;
+        }));
+    } catch (const std::runtime_error &) {
+        thrown = true;
+    }
+    return thrown && CFGetRetainCount(shared.get()) == 1;
+}
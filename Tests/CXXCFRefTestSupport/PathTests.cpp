@@ -0,0 +1,123 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cf/Paths.hpp"
+
+namespace {
+
+/// Returns the file system path of `url`, or an empty string if it has none.
+std::string pathOf(CFURLRef _Nullable url) {
+    std::string result;
+    cf::with_fs_path(url, [&](std::string_view path) { result = path; });
+    return result;
+}
+
+/// Returns a relative path longer than `PATH_MAX`.
+std::string longRelativePath() {
+    std::string path;
+    while (path.size() <= cf::detail::pathBufferSize) {
+        path += std::string(200, 'x') + '/';
+    }
+    return path + "file";
+}
+
+} /* namespace */
+
+bool cftest::pathRoundTrip() {
+    // A path within the stack buffer is written directly
+    const auto url = cf::url_from_path("/tmp/CXXCFRef path.txt");
+    if (!url || pathOf(url) != "/tmp/CXXCFRef path.txt") {
+        return false;
+    }
+
+    // A path longer than the stack buffer takes the heap fallback
+    const auto longPath = "/tmp/" + longRelativePath();
+    const auto longURL = cf::url_from_path(longPath);
+    if (!longURL || pathOf(longURL) != longPath) {
+        return false;
+    }
+
+    // A relative URL is resolved against its base on both paths
+    const auto base = cf::url_from_path("/tmp/CXXCFRef/", true);
+    const auto relative = cf::CFURL::adopt(CFURLCreateWithFileSystemPathRelativeToBase(
+            kCFAllocatorDefault, CFSTR("a/b.txt"), kCFURLPOSIXPathStyle, false, base));
+    if (!relative || pathOf(relative) != "/tmp/CXXCFRef/a/b.txt") {
+        return false;
+    }
+    const auto longRelative = longRelativePath();
+    const auto longString = cf::CFString::adopt(
+            CFStringCreateWithCString(kCFAllocatorDefault, longRelative.c_str(), kCFStringEncodingUTF8));
+    const auto longRelativeURL = cf::CFURL::adopt(CFURLCreateWithFileSystemPathRelativeToBase(
+            kCFAllocatorDefault, longString, kCFURLPOSIXPathStyle, false, base));
+    return longRelativeURL && pathOf(longRelativeURL) == "/tmp/CXXCFRef/" + longRelative;
+}
+
+bool cftest::pathNonFileURLs() {
+    const auto web = cf::CFURL::adopt(CFURLCreateWithString(kCFAllocatorDefault, CFSTR("https://example.com/a/b"),
+                                                              nullptr));
+    const auto file = cf::url_from_path("/tmp/CXXCFRef.txt");
+    if (!web || !file) {
+        return false;
+    }
+
+    bool called = false;
+    if (cf::with_fs_path(web, [&](std::string_view) { called = true; }) || called ||
+        cf::with_fs_path(nullptr, [&](std::string_view) { called = true; }) || called) {
+        return false;
+    }
+
+    // Elements without a file system representation are skipped but keep their indices
+    const void *values[] = {web.get(), file.get(), web.get()};
+    const auto urls = cf::CFArray::adopt(CFArrayCreate(kCFAllocatorDefault, values, 3, &kCFTypeArrayCallBacks));
+    std::vector<std::size_t> indices;
+    const auto visited = cf::for_each_fs_path(urls, [&](std::size_t index, std::string_view path) {
+        if (path == "/tmp/CXXCFRef.txt") {
+            indices.push_back(index);
+        }
+    });
+    return visited == 1 && indices == std::vector<std::size_t>{1} &&
+           cf::for_each_fs_path(nullptr, [](std::size_t, std::string_view) {}) == 0;
+}
+
+bool cftest::pathBatchForms() {
+    // More paths than the inline capacity so that the storage grows while URLs are held
+    std::vector<std::string> paths;
+    for (std::size_t i = 0; i < 2 * cf::detail::builderInlineCapacity + 1; ++i) {
+        paths.push_back("/tmp/CXXCFRef/" + std::to_string(i));
+    }
+    const auto urls = cf::urls_from_paths(paths);
+    if (!urls || CFArrayGetCount(urls) != static_cast<CFIndex>(paths.size())) {
+        return false;
+    }
+    std::size_t matched = 0;
+    const auto visited = cf::for_each_fs_path(urls, [&](std::size_t index, std::string_view path) {
+        matched += index < paths.size() && path == paths[index] ? 1 : 0;
+    });
+    if (visited != paths.size() || matched != paths.size()) {
+        return false;
+    }
+
+    // Any range of string views is accepted and directories are flagged as such
+    const std::string_view views[] = {"/tmp/a", "/tmp/b"};
+    const auto directories = cf::urls_from_paths(views, true);
+    if (!directories || CFArrayGetCount(directories) != 2 ||
+        !CFURLHasDirectoryPath(static_cast<CFURLRef>(CFArrayGetValueAtIndex(directories, 1))) ||
+        pathOf(static_cast<CFURLRef>(CFArrayGetValueAtIndex(directories, 0))) != "/tmp/a") {
+        return false;
+    }
+
+    // An empty range produces an empty array
+    const auto empty = cf::urls_from_paths(std::vector<std::string>{});
+    return empty && CFArrayGetCount(empty) == 0;
+}
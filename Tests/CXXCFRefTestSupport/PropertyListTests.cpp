@@ -0,0 +1,176 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "TemporaryFile.hpp"
+#include "cf/Builders.hpp"
+#include "cf/Numbers.hpp"
+#include "cf/PropertyLists.hpp"
+
+namespace {
+
+/// Creates a property list whose encoding is several kilobytes in both the binary and XML formats.
+cf::CFDictionary makePropertyList() {
+    std::vector<cf::CFString> strings;
+    for (int i = 0; i < 200; ++i) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof buffer, "property list element %d", i);
+        strings.push_back(cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, buffer,
+                                                                          kCFStringEncodingUTF8)));
+    }
+    const UInt8 bytes[] = {0, 1, 2, 3, 0xfe, 0xff};
+    const auto data = cf::CFData::adopt(CFDataCreate(kCFAllocatorDefault, bytes, sizeof bytes));
+    const auto elements = cf::make_array(strings);
+    const auto number = cf::make_number(48000);
+    return cf::make_dictionary({{CFSTR("elements"), elements.get()},
+                                {CFSTR("data"), data.get()},
+                                {CFSTR("rate"), number.get()},
+                                {CFSTR("flag"), kCFBooleanTrue}});
+}
+
+/// Returns the size of the file open as `fd`, or -1 on failure.
+long long fileSize(int fd) noexcept {
+    struct stat status;
+    return ::fstat(fd, &status) == 0 ? static_cast<long long>(status.st_size) : -1;
+}
+
+/// Returns true if `error` is a POSIX-domain error with `code`, and releases it.
+bool isPOSIXError(CFErrorRef _Nullable error, int code) noexcept {
+    if (error == nullptr) {
+        return false;
+    }
+    const auto matches = CFEqual(CFErrorGetDomain(error), kCFErrorDomainPOSIX) && CFErrorGetCode(error) == code;
+    CFRelease(error);
+    return matches;
+}
+
+/// Writes `propertyList` to a temporary file in `format` through the file descriptor overload and reads it back.
+bool roundTripsThroughFile(CFPropertyListRef _Nonnull propertyList, CFPropertyListFormat format) {
+    cftest::TemporaryFile file;
+    if (!file) {
+        return false;
+    }
+    // A small chunk size makes the encoding pass through the bound pair many times
+    const auto written = cf::write_property_list(propertyList, file.fd(), format, 256);
+    if (written <= 256 || fileSize(file.fd()) != written) {
+        return false;
+    }
+    CFPropertyListFormat readFormat = 0;
+    const auto read = cf::read_property_list(file.path(), kCFPropertyListImmutable, &readFormat);
+    return read && readFormat == format && CFEqual(read, propertyList);
+}
+
+} /* namespace */
+
+bool cftest::propertyListFileRoundTrip() {
+    const auto propertyList = makePropertyList();
+    return propertyList && roundTripsThroughFile(propertyList, kCFPropertyListBinaryFormat_v1_0) &&
+           roundTripsThroughFile(propertyList, kCFPropertyListXMLFormat_v1_0);
+}
+
+bool cftest::propertyListStreamRoundTrip() {
+    const auto propertyList = makePropertyList();
+    const auto output =
+            cf::CFWriteStream::adopt(CFWriteStreamCreateWithAllocatedBuffers(kCFAllocatorDefault, kCFAllocatorDefault));
+    if (!propertyList || !output || !CFWriteStreamOpen(output)) {
+        return false;
+    }
+    const auto written = cf::write_property_list(propertyList, output);
+    const auto data = cf::CFData::adopt(
+            static_cast<CFDataRef>(CFWriteStreamCopyProperty(output, kCFStreamPropertyDataWritten)));
+    CFWriteStreamClose(output);
+    if (written <= 0 || !data || CFDataGetLength(data) != written) {
+        return false;
+    }
+
+    const auto input = cf::CFReadStream::adopt(CFReadStreamCreateWithBytesNoCopy(
+            kCFAllocatorDefault, CFDataGetBytePtr(data), CFDataGetLength(data), kCFAllocatorNull));
+    if (!input || !CFReadStreamOpen(input)) {
+        return false;
+    }
+    CFPropertyListFormat format = 0;
+    const auto read = cf::read_property_list(input, kCFPropertyListImmutable, &format);
+    CFReadStreamClose(input);
+    return read && format == kCFPropertyListBinaryFormat_v1_0 && CFEqual(read, propertyList);
+}
+
+bool cftest::propertyListWriteErrors() {
+    const auto propertyList = makePropertyList();
+    if (!propertyList) {
+        return false;
+    }
+
+    // A chunk size that is not positive is rejected before anything is written
+    CFErrorRef error = nullptr;
+    if (cf::write_property_list(propertyList, STDOUT_FILENO, kCFPropertyListBinaryFormat_v1_0, 0, &error) != 0 ||
+        !isPOSIXError(error, EINVAL)) {
+        return false;
+    }
+
+    // Writing to a pipe whose read end is closed fails with EPIPE, which is reported instead of the encoder's error
+    int fds[2];
+    if (::pipe(fds) != 0) {
+        return false;
+    }
+    ::close(fds[0]);
+#if defined(F_SETNOSIGPIPE)
+    // Report EPIPE instead of raising SIGPIPE
+    ::fcntl(fds[1], F_SETNOSIGPIPE, 1);
+#else
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+    error = nullptr;
+    const auto written = cf::write_property_list(propertyList, fds[1], kCFPropertyListBinaryFormat_v1_0, 256, &error);
+    ::close(fds[1]);
+    return written == 0 && isPOSIXError(error, EPIPE);
+}
+
+bool cftest::readPropertyListFromPath() {
+    // A missing file reports the mapping error
+    TemporaryFile missing;
+    if (!missing) {
+        return false;
+    }
+    const std::string path = missing.path() + std::string{".missing"};
+    CFErrorRef error = nullptr;
+    if (cf::read_property_list(path.c_str(), kCFPropertyListImmutable, nullptr, &error) ||
+        !isPOSIXError(error, ENOENT)) {
+        return false;
+    }
+
+    // A file that is not a property list fails to decode
+    TemporaryFile invalid;
+    const UInt8 bytes[] = {'b', 'p', 'l', 'i', 's', 't', '0', '0', 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+    if (!invalid || !invalid.write(bytes, sizeof bytes)) {
+        return false;
+    }
+    error = nullptr;
+    if (cf::read_property_list(invalid.path(), kCFPropertyListImmutable, nullptr, &error) || error == nullptr) {
+        return false;
+    }
+    CFRelease(error);
+
+    // Mutable containers may be requested when reading
+    TemporaryFile valid;
+    const auto propertyList = makePropertyList();
+    if (!valid || cf::write_property_list(propertyList, valid.fd()) == 0) {
+        return false;
+    }
+    const auto read = cf::read_property_list(valid.path(), kCFPropertyListMutableContainers);
+    return read && CFGetTypeID(read) == CFDictionaryGetTypeID() && CFEqual(read, propertyList);
+}
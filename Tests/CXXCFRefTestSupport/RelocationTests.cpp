@@ -0,0 +1,94 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "cf/CFRefCore.hpp"
+#include "cf/CFUniqueRef.hpp"
+#include "cf/Relocation.hpp"
+
+namespace {
+
+/// A type that counts its move constructions and destructions.
+struct Counted {
+    static inline int moves = 0;
+    static inline int destructions = 0;
+
+    explicit Counted(int value) noexcept : value{value} {}
+    Counted(Counted &&other) noexcept : value{other.value} {
+        ++moves;
+        other.value = -1;
+    }
+    ~Counted() { ++destructions; }
+
+    int value;
+};
+
+static_assert(cf::is_trivially_relocatable_v<int> && cf::is_trivially_relocatable_v<CFTypeRef>);
+static_assert(cf::is_trivially_relocatable_v<cf::CFString> &&
+              cf::is_trivially_relocatable_v<cf::CFUniqueRef<CFStringRef>>);
+static_assert(!cf::is_trivially_relocatable_v<Counted> && !cf::is_trivially_relocatable_v<std::string>);
+
+/// Uninitialized storage for `N` objects of type `T`.
+template <typename T, std::size_t N> struct Storage {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    T *data() noexcept { return reinterpret_cast<T *>(bytes); }
+};
+
+} /* namespace */
+
+bool cftest::relocateTriviallyRelocatable() {
+    const auto data = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!data) {
+        return false;
+    }
+
+    // CFRefs are relocated by copying their bytes, without retaining or releasing
+    Storage<cf::CFMutableData, 3> source;
+    Storage<cf::CFMutableData, 3> destination;
+    for (std::size_t i = 0; i < 3; ++i) {
+        ::new (static_cast<void *>(source.data() + i)) cf::CFMutableData(i == 1 ? cf::CFMutableData{} : data);
+    }
+    if (CFGetRetainCount(data.get()) != 3) {
+        return false;
+    }
+    const auto end = cf::uninitialized_relocate(source.data(), source.data() + 3, destination.data());
+    const auto *relocated = destination.data();
+    bool result = end == destination.data() + 3 && relocated[0].get() == data.get() && !relocated[1] &&
+                  relocated[2].get() == data.get() && CFGetRetainCount(data.get()) == 3;
+    std::destroy(destination.data(), end);
+
+    // An empty range relocates nothing
+    const auto empty = cf::uninitialized_relocate(source.data(), source.data(), destination.data());
+    result = result && empty == destination.data();
+    return result && CFGetRetainCount(data.get()) == 1;
+}
+
+bool cftest::relocateMoveConstructible() {
+    Storage<Counted, 4> source;
+    Storage<Counted, 4> destination;
+    for (int i = 0; i < 4; ++i) {
+        ::new (static_cast<void *>(source.data() + i)) Counted(i);
+    }
+    Counted::moves = 0;
+    Counted::destructions = 0;
+
+    // Other types are moved and each source is destroyed
+    const auto end = cf::uninitialized_relocate(source.data(), source.data() + 4, destination.data());
+    bool result = end == destination.data() + 4 && Counted::moves == 4 && Counted::destructions == 4;
+    for (int i = 0; i < 4; ++i) {
+        result = result && destination.data()[i].value == i;
+    }
+    std::destroy(destination.data(), end);
+    return result && Counted::destructions == 8;
+}
@@ -0,0 +1,288 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "cf/Streams.hpp"
+
+namespace {
+
+/// The buffer size of the bound stream pairs.
+constexpr CFIndex pairBufferSize = 16;
+
+/// The result of an asynchronous operation and whether it has completed.
+struct Completion {
+    bool done{false};
+    cf::StreamResult result;
+
+    /// Returns a completion function that stores the result in this object.
+    auto handler() noexcept {
+        return [this](cf::StreamResult result) noexcept {
+            this->result = std::move(result);
+            done = true;
+        };
+    }
+};
+
+/// Runs the current run loop until `done` is set or a few seconds have passed.
+/// @return The final value of `done`.
+bool runUntil(const bool &done) {
+    for (int i = 0; i < 500 && !done; ++i) {
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.01, true);
+    }
+    return done;
+}
+
+/// Schedules a read stream on the current run loop and opens it.
+bool scheduleAndOpen(CFReadStreamRef _Nonnull stream) {
+    CFReadStreamScheduleWithRunLoop(stream, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    if (!CFReadStreamOpen(stream)) {
+        return false;
+    }
+    for (int i = 0; i < 500 && CFReadStreamGetStatus(stream) == kCFStreamStatusOpening; ++i) {
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.01, true);
+    }
+    return CFReadStreamGetStatus(stream) == kCFStreamStatusOpen;
+}
+
+/// Schedules a write stream on the current run loop and opens it.
+bool scheduleAndOpen(CFWriteStreamRef _Nonnull stream) {
+    CFWriteStreamScheduleWithRunLoop(stream, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    if (!CFWriteStreamOpen(stream)) {
+        return false;
+    }
+    for (int i = 0; i < 500 && CFWriteStreamGetStatus(stream) == kCFStreamStatusOpening; ++i) {
+        CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0.01, true);
+    }
+    return CFWriteStreamGetStatus(stream) == kCFStreamStatusOpen;
+}
+
+/// A bound stream pair scheduled on the current run loop, which is closed and unscheduled when destroyed.
+struct BoundPair {
+    cf::CFReadStream input;
+    cf::CFWriteStream output;
+
+    /// Creates the pair and opens it if `open` is true.
+    explicit BoundPair(bool open = true) {
+        CFReadStreamRef readStream = nullptr;
+        CFWriteStreamRef writeStream = nullptr;
+        CFStreamCreateBoundPair(kCFAllocatorDefault, &readStream, &writeStream, pairBufferSize);
+        input = cf::CFReadStream::adopt(readStream);
+        output = cf::CFWriteStream::adopt(writeStream);
+        opened = input && output && (!open || (scheduleAndOpen(input) && scheduleAndOpen(output)));
+    }
+
+    BoundPair(const BoundPair &) = delete;
+    BoundPair &operator=(const BoundPair &) = delete;
+
+    ~BoundPair() {
+        if (input) {
+            CFReadStreamUnscheduleFromRunLoop(input, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+            CFReadStreamClose(input);
+        }
+        if (output) {
+            CFWriteStreamUnscheduleFromRunLoop(output, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+            CFWriteStreamClose(output);
+        }
+    }
+
+    /// Returns true if the pair was created and opened as requested.
+    [[nodiscard]] explicit operator bool() const noexcept { return opened; }
+
+    /// Writes a string synchronously.
+    bool write(const char *string) const noexcept {
+        const auto length = static_cast<CFIndex>(std::strlen(string));
+        return CFWriteStreamWrite(output, reinterpret_cast<const UInt8 *>(string), length) == length;
+    }
+
+    /// Writes until the pair's buffer is full.
+    bool fill() const noexcept {
+        const UInt8 bytes[pairBufferSize] = {};
+        while (CFWriteStreamCanAcceptBytes(output)) {
+            if (CFWriteStreamWrite(output, bytes, pairBufferSize) <= 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool opened{false};
+};
+
+/// Returns true if a successful result transferred exactly the bytes of `string`.
+bool transferred(const cf::StreamResult &result, const char *string) noexcept {
+    const auto length = std::strlen(string);
+    return result && result.bytes.size() == length && std::memcmp(result.bytes.data(), string, length) == 0;
+}
+
+/// Returns true if a result failed with a POSIX-domain error with `code`.
+bool failedWith(const cf::StreamResult &result, int code) noexcept {
+    return !result && CFEqual(CFErrorGetDomain(result.error), kCFErrorDomainPOSIX) &&
+           CFErrorGetCode(result.error) == code;
+}
+
+} /* namespace */
+
+bool cftest::streamImmediateCompletion() {
+    BoundPair pair;
+    if (!pair || !pair.write("hello")) {
+        return false;
+    }
+
+    // Bytes are already available, so the read completes before returning
+    std::uint8_t buffer[64];
+    Completion read;
+    cf::async_read(pair.input, buffer, read.handler());
+    if (!read.done || !transferred(read.result, "hello") || read.result.bytes.data() != buffer) {
+        return false;
+    }
+
+    // The buffer has room, so the write completes before returning
+    const std::uint8_t bytes[] = {1, 2, 3, 4};
+    Completion write;
+    cf::async_write(pair.output, bytes, write.handler());
+    return write.done && write.result && write.result.bytes.size() > 0 && write.result.bytes.size() <= sizeof bytes &&
+           write.result.bytes.data() == bytes;
+}
+
+bool cftest::streamAsynchronousCompletion() {
+    BoundPair pair;
+    if (!pair) {
+        return false;
+    }
+
+    // The read waits for bytes to be written
+    std::uint8_t buffer[64];
+    Completion read;
+    cf::async_read(pair.input, buffer, read.handler());
+    if (read.done || !pair.write("abc") || !runUntil(read.done) || !transferred(read.result, "abc")) {
+        return false;
+    }
+
+    // The write waits for the full buffer to be drained
+    if (!pair.fill()) {
+        return false;
+    }
+    const std::uint8_t bytes[] = {5, 6, 7};
+    Completion write;
+    cf::async_write(pair.output, bytes, write.handler());
+    if (write.done || CFReadStreamRead(pair.input, buffer, sizeof buffer) <= 0 || !runUntil(write.done)) {
+        return false;
+    }
+    return write.result && write.result.bytes.size() > 0 && write.result.bytes.data() == bytes;
+}
+
+bool cftest::streamEndOfStream() {
+    BoundPair pair;
+    if (!pair) {
+        return false;
+    }
+
+    // A pending read completes at the end of the stream without an error
+    std::uint8_t buffer[64];
+    Completion pending;
+    cf::async_read(pair.input, buffer, pending.handler());
+    if (pending.done) {
+        return false;
+    }
+    CFWriteStreamClose(pair.output);
+    if (!runUntil(pending.done) || !pending.result.atEnd()) {
+        return false;
+    }
+
+    // Later reads report the end again
+    Completion again;
+    cf::async_read(pair.input, buffer, again.handler());
+    if (!runUntil(again.done) || !again.result.atEnd()) {
+        return false;
+    }
+
+    // A write to the closed stream fails instead of reporting that nothing was written
+    const std::uint8_t bytes[] = {1};
+    Completion write;
+    cf::async_write(pair.output, bytes, write.handler());
+    return write.done && failedWith(write.result, EPIPE) && !write.result.atEnd();
+}
+
+bool cftest::streamErrors() {
+    // Streams that are not open fail immediately
+    BoundPair unopened{false};
+    if (!unopened.input || !unopened.output) {
+        return false;
+    }
+    std::uint8_t buffer[64];
+    Completion read;
+    cf::async_read(unopened.input, buffer, read.handler());
+    const std::uint8_t bytes[] = {1, 2, 3};
+    Completion write;
+    cf::async_write(unopened.output, bytes, write.handler());
+    if (!read.done || !failedWith(read.result, ENOTCONN) || !write.done || !failedWith(write.result, ENOTCONN)) {
+        return false;
+    }
+
+    // A write whose reader has gone away fails, whether it fails immediately or after an event
+    BoundPair pair;
+    if (!pair || !pair.fill()) {
+        return false;
+    }
+    Completion orphaned;
+    cf::async_write(pair.output, bytes, orphaned.handler());
+    CFReadStreamClose(pair.input);
+    return runUntil(orphaned.done) && !orphaned.result && orphaned.result.bytes.size() == 0;
+}
+
+bool cftest::streamBufferedRead() {
+    // A memory stream exposes its bytes, which are viewed instead of copied into the smaller fallback buffer
+    std::uint8_t source[100];
+    for (std::size_t i = 0; i < sizeof source; ++i) {
+        source[i] = static_cast<std::uint8_t>(i);
+    }
+    const auto stream = cf::CFReadStream::adopt(
+            CFReadStreamCreateWithBytesNoCopy(kCFAllocatorDefault, source, sizeof source, kCFAllocatorNull));
+    if (!stream || !scheduleAndOpen(stream)) {
+        return false;
+    }
+    std::uint8_t fallback[8];
+    std::size_t total = 0;
+    bool viewed = false;
+    for (;;) {
+        Completion read;
+        cf::async_read_buffered(stream, fallback, read.handler());
+        if (!runUntil(read.done) || !read.result) {
+            return false;
+        }
+        if (read.result.atEnd()) {
+            break;
+        }
+        const auto &bytes = read.result.bytes;
+        if (total + bytes.size() > sizeof source || std::memcmp(bytes.data(), source + total, bytes.size()) != 0) {
+            return false;
+        }
+        viewed = viewed || (bytes.data() == source + total && bytes.size() > sizeof fallback);
+        total += bytes.size();
+    }
+    CFReadStreamUnscheduleFromRunLoop(stream, CFRunLoopGetCurrent(), kCFRunLoopDefaultMode);
+    CFReadStreamClose(stream);
+    if (total != sizeof source || !viewed) {
+        return false;
+    }
+
+    // A bound pair is read either from its internal buffer or into the fallback
+    BoundPair pair;
+    if (!pair || !pair.write("xyz")) {
+        return false;
+    }
+    Completion read;
+    cf::async_read_buffered(pair.input, fallback, read.handler());
+    return runUntil(read.done) && transferred(read.result, "xyz");
+}
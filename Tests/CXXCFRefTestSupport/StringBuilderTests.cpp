@@ -0,0 +1,161 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "cf/StringBuilder.hpp"
+
+namespace {
+
+static_assert(cf::detail::count_placeholders("") == 0 && cf::detail::count_placeholders("{}") == 1 &&
+                      cf::detail::count_placeholders("{}:{}") == 2 && cf::detail::count_placeholders("{{}}") == 0 &&
+                      cf::detail::count_placeholders("{{{}}}") == 1 && cf::detail::count_placeholders("a}}b{{") == 0,
+              "Placeholders are counted and escaped braces are skipped");
+static_assert(cf::detail::count_placeholders("{") == -1 && cf::detail::count_placeholders("}") == -1 &&
+                      cf::detail::count_placeholders("{x}") == -1 && cf::detail::count_placeholders("a}b") == -1 &&
+                      cf::detail::count_placeholders("{}}") == -1,
+              "Unmatched braces are rejected");
+
+/// Returns the UTF-8 contents of a builder after appending `value`.
+template <typename T> std::string appended(const T &value) {
+    cf::StringBuilder<> builder;
+    builder.append(value);
+    return std::string{builder.view()};
+}
+
+/// Returns true if appending `value` produces text that parses back to `value`.
+template <typename T> bool roundTrips(T value) {
+    const auto text = appended(value);
+    char *end = nullptr;
+    const T parsed = std::is_same_v<T, float> ? std::strtof(text.c_str(), &end) : std::strtod(text.c_str(), &end);
+    return end == text.c_str() + text.size() && (parsed == value || (std::isnan(parsed) && std::isnan(value))) &&
+           std::signbit(parsed) == std::signbit(value);
+}
+
+/// Creates a CFString from UTF-16 code units.
+cf::CFString makeString(std::u16string_view characters) {
+    return cf::CFString::adopt(CFStringCreateWithCharacters(kCFAllocatorDefault,
+                                                            reinterpret_cast<const UniChar *>(characters.data()),
+                                                            static_cast<CFIndex>(characters.size())));
+}
+
+} /* namespace */
+
+bool cftest::stringBuilderIntegers() {
+    return appended(0) == "0" && appended(-1) == "-1" &&
+           appended(std::numeric_limits<std::int8_t>::min()) == "-128" &&
+           appended(std::numeric_limits<std::uint8_t>::max()) == "255" &&
+           appended(std::numeric_limits<std::int16_t>::min()) == "-32768" &&
+           appended(std::numeric_limits<std::int32_t>::min()) == "-2147483648" &&
+           appended(std::numeric_limits<std::uint32_t>::max()) == "4294967295" &&
+           appended(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808" &&
+           appended(std::numeric_limits<std::int64_t>::max()) == "9223372036854775807" &&
+           appended(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615" && appended('x') == "x" &&
+           appended(true) == "true" && appended(false) == "false";
+}
+
+bool cftest::stringBuilderFloatingPoint() {
+    for (const double value : {0.0, -0.0, 0.1, 1.0 / 3.0, -2.5, 1e300, 5e-324, std::numeric_limits<double>::max(),
+                               std::numeric_limits<double>::min(), std::numeric_limits<double>::infinity()}) {
+        if (!roundTrips(value)) {
+            return false;
+        }
+    }
+    for (const float value : {0.1f, -1.5f, 3.4028235e38f, 1e-45f, std::numeric_limits<float>::quiet_NaN()}) {
+        if (!roundTrips(value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool cftest::stringBuilderSurrogates() {
+    // A valid pair becomes one four-byte sequence; unpaired surrogates become U+FFFD
+    if (appended(std::u16string_view{u"a\U0001F600b"}) != "a\xF0\x9F\x98\x80"
+                                                              "b") {
+        return false;
+    }
+    const char16_t unpaired[] = {u'a', 0xD800, u'b', 0xDC00, 0xD83D};
+    const std::u16string_view unpairedView{unpaired, 5};
+    const std::string replaced = "a\xEF\xBF\xBD"
+                                 "b\xEF\xBF\xBD\xEF\xBF\xBD";
+    if (appended(unpairedView) != replaced) {
+        return false;
+    }
+
+    // A CFString that CFStringGetBytes cannot convert is appended in full, with the same replacements
+    const auto string = makeString(unpairedView);
+    const auto paired = makeString(u"été \U0001F600");
+    cf::StringBuilder<> builder;
+    builder.append("<").append(string).append(">").append(paired);
+    return string && builder.view() == "<" + replaced + ">\xC3\xA9t\xC3\xA9 \xF0\x9F\x98\x80" &&
+           appended(static_cast<CFStringRef>(nullptr)).empty();
+}
+
+bool cftest::stringBuilderGrowth() {
+    // Appends well past the inline capacity, through every kind of piece
+    cf::StringBuilder<8> builder;
+    std::string expected;
+    for (int i = 0; i < 200; ++i) {
+        builder << "item " << i << ',';
+        expected += "item " + std::to_string(i) + ',';
+    }
+    builder.append(std::u16string_view{u"é"});
+    expected += "\xC3\xA9";
+    if (builder.view() != expected || builder.size() != expected.size()) {
+        return false;
+    }
+
+    const auto built = builder.build();
+    if (!built || CFStringGetLength(built) != static_cast<CFIndex>(expected.size() - 1)) {
+        return false;
+    }
+    builder.clear();
+    return builder.empty() && builder.append("x").view() == "x";
+}
+
+bool cftest::stringBuilderConcat() {
+    const auto extension = makeString(u"flac");
+    const auto result = cf::concat("track-", 7, '.', extension, ' ', -1.5, ' ', true);
+    const auto expected = cf::CFString::adopt(
+            CFStringCreateWithCString(kCFAllocatorDefault, "track-7.flac -1.5 true", kCFStringEncodingUTF8));
+    return result && result == expected && cf::concat() && CFStringGetLength(cf::concat()) == 0;
+}
+
+bool cftest::stringBuilderFormatText() {
+    // Literal runs are appended up to each placeholder, with escaped braces reduced to one
+    constexpr std::string_view format = "a{{b}}c{}d}}{}";
+    cf::StringBuilder<> builder;
+    auto position = cf::detail::append_format_text(builder, format, 0);
+    if (builder.view() != "a{b}c" || position != 9) {
+        return false;
+    }
+    position = cf::detail::append_format_text(builder, format, position);
+    if (builder.view() != "a{b}cd}" || position != format.size()) {
+        return false;
+    }
+    position = cf::detail::append_format_text(builder, format, position);
+    if (builder.view() != "a{b}cd}" || position != format.size()) {
+        return false;
+    }
+
+#if __cpp_nontype_template_args >= 201911L
+    const auto formatted = cf::format<"{{{}}}:{}">(42, "x");
+    const auto expected = cf::CFString::adopt(CFStringCreateWithCString(kCFAllocatorDefault, "{42}:x",
+                                                                          kCFStringEncodingUTF8));
+    return formatted == expected;
+#else
+    return true;
+#endif
+}
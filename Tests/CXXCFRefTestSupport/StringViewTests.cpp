@@ -0,0 +1,99 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <string>
+#include <string_view>
+
+#include "cf/CFRefCore.hpp"
+#include "cf/StringView.hpp"
+
+namespace {
+
+/// Creates a CFString from UTF-8.
+cf::CFString makeString(std::string_view string) {
+    return cf::CFString::adopt(CFStringCreateWithBytes(kCFAllocatorDefault,
+                                                       reinterpret_cast<const UInt8 *>(string.data()),
+                                                       static_cast<CFIndex>(string.size()), kCFStringEncodingUTF8,
+                                                       false));
+}
+
+/// Returns `count` copies of `piece`.
+std::string repeated(std::string_view piece, std::size_t count) {
+    std::string result;
+    for (std::size_t i = 0; i < count; ++i) {
+        result += piece;
+    }
+    return result;
+}
+
+/// Returns true if a UTF8Buffer of `string` holds `expected` and is direct exactly when a direct pointer exists.
+template <std::size_t N> bool holdsUTF8(CFStringRef _Nonnull string, std::string_view expected, bool mustCopy) {
+    const cf::UTF8Buffer<N> buffer{string};
+    const auto direct = cf::cstring_view(string, kCFStringEncodingUTF8);
+    if (buffer.view() != expected || buffer.isDirect() != direct.has_value() || (mustCopy && buffer.isDirect())) {
+        return false;
+    }
+    return !direct || buffer.view().data() == direct->data();
+}
+
+/// Returns true if a UTF16Buffer of `string` holds its characters and is direct exactly when a direct pointer exists.
+template <std::size_t N> bool holdsUTF16(CFStringRef _Nonnull string, bool mustCopy) {
+    const cf::UTF16Buffer<N> buffer{string};
+    const auto direct = cf::characters_view(string);
+    const auto length = CFStringGetLength(string);
+    if (buffer.view().size() != static_cast<std::size_t>(length) || buffer.isDirect() != direct.has_value() ||
+        (mustCopy && buffer.isDirect()) || (direct && buffer.view().data() != direct->data())) {
+        return false;
+    }
+    for (CFIndex i = 0; i < length; ++i) {
+        if (buffer.view()[static_cast<std::size_t>(i)] != CFStringGetCharacterAtIndex(string, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} /* namespace */
+
+bool cftest::utf8BufferPaths() {
+    // A null string has no contents and is never direct
+    const cf::UTF8Buffer<> null{nullptr};
+    if (null.isDirect() || !null.view().empty()) {
+        return false;
+    }
+
+    // ASCII may be viewed directly; non-ASCII text is always converted, inline or on the heap
+    const std::string ascii = repeated("direct ", 8);
+    const std::string accented = repeated("\xC3\xA9t\xC3\xA9 ", 2);
+    const std::string longAccented = repeated("\xC3\xA9t\xC3\xA9 ", 40);
+    const auto asciiString = makeString(ascii);
+    const auto accentedString = makeString(accented);
+    const auto longAccentedString = makeString(longAccented);
+    const auto emptyString = makeString("");
+    return asciiString && accentedString && longAccentedString && emptyString &&
+           holdsUTF8<256>(asciiString, ascii, false) && holdsUTF8<256>(accentedString, accented, true) &&
+           holdsUTF8<16>(longAccentedString, longAccented, true) && holdsUTF8<256>(emptyString, "", false);
+}
+
+bool cftest::utf16BufferPaths() {
+    const cf::UTF16Buffer<> null{nullptr};
+    if (null.isDirect() || !null.view().empty()) {
+        return false;
+    }
+
+    // Characters created without copying may be viewed directly; other contents are copied inline or on the heap
+    const UniChar characters[] = {'d', 'i', 'r', 'e', 'c', 't', ' ', 0x00E9, 0x4E2D, 0xD83D, 0xDE00};
+    const auto noCopy = cf::CFString::adopt(CFStringCreateWithCharactersNoCopy(
+            kCFAllocatorDefault, characters, sizeof characters / sizeof *characters, kCFAllocatorNull));
+    const auto ascii = makeString(repeated("copied ", 4));
+    const auto longASCII = makeString(repeated("copied ", 40));
+    const auto emptyString = makeString("");
+    return noCopy && ascii && longASCII && emptyString && holdsUTF16<128>(noCopy, false) &&
+           holdsUTF16<128>(ascii, false) && holdsUTF16<8>(longASCII, false) && holdsUTF16<128>(emptyString, false);
+}
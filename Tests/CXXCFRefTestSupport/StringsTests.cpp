@@ -0,0 +1,42 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cf/Strings.hpp"
+
+bool cftest::toCFArrayRoundTrip() {
+    // More strings than the inline capacity, including non-ASCII and empty strings
+    std::vector<std::string> strings = {"", "caf\xc3\xa9", "\xf0\x9f\x8e\xb5 notes"};
+    while (strings.size() <= 2 * cf::detail::builderInlineCapacity) {
+        strings.push_back("string " + std::to_string(strings.size()));
+    }
+    const auto array = cf::to_cf_array(strings);
+    if (!array || CFArrayGetCount(array) != static_cast<CFIndex>(strings.size()) || cf::to_strings(array) != strings) {
+        return false;
+    }
+
+    const char *literals[] = {"a", "b"};
+    const std::string_view views[] = {"c", "d", "e"};
+    const auto fromLiterals = cf::to_cf_array(literals);
+    const auto fromViews = cf::to_cf_array(views);
+    return fromLiterals && cf::to_strings(fromLiterals) == std::vector<std::string>{"a", "b"} && fromViews &&
+           cf::to_strings(fromViews) == std::vector<std::string>{"c", "d", "e"} && cf::to_strings(nullptr).empty();
+}
+
+bool cftest::toCFArrayInvalidElement() {
+    // An element that is not valid UTF-8 fails the whole conversion, wherever it occurs
+    const std::vector<std::string> first = {"\xff", "valid"};
+    const std::vector<std::string> middle = {"valid", "\xc3", "valid"};
+    std::vector<std::string> last(2 * cf::detail::builderInlineCapacity, "valid");
+    last.push_back("\xfe");
+    return !cf::to_cf_array(first) && !cf::to_cf_array(middle) && !cf::to_cf_array(last);
+}
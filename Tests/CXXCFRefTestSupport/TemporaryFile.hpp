@@ -0,0 +1,78 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+#include <unistd.h>
+
+namespace cftest {
+
+/// An empty file in the temporary directory, open for reading and writing, that is removed when destroyed.
+class TemporaryFile final {
+  public:
+    /// Creates the file.
+    TemporaryFile() {
+        const char *directory = std::getenv("TMPDIR");
+        path_ = directory != nullptr && *directory != '\0' ? directory : "/tmp";
+        if (path_.back() != '/') {
+            path_ += '/';
+        }
+        path_ += "CXXCFRefTests.XXXXXX";
+        fd_ = ::mkstemp(path_.data());
+    }
+
+    TemporaryFile(const TemporaryFile &) = delete;
+    TemporaryFile &operator=(const TemporaryFile &) = delete;
+
+    /// Closes and removes the file.
+    ~TemporaryFile() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            ::unlink(path_.c_str());
+        }
+    }
+
+    /// Returns true if the file was created.
+    [[nodiscard]] explicit operator bool() const noexcept { return fd_ >= 0; }
+
+    /// Returns the file descriptor.
+    [[nodiscard]] int fd() const noexcept { return fd_; }
+
+    /// Returns the path of the file.
+    [[nodiscard]] const char *path() const noexcept { return path_.c_str(); }
+
+    /// Writes bytes at the current offset.
+    /// @return True if every byte was written.
+    bool write(const void *bytes, std::size_t length) noexcept {
+        const auto *next = static_cast<const char *>(bytes);
+        while (length > 0) {
+            const auto written = ::write(fd_, next, length);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            next += written;
+            length -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+  private:
+    /// The path of the file.
+    std::string path_;
+    /// The file descriptor, or -1 if the file could not be created.
+    int fd_{-1};
+};
+
+} /* namespace cftest */
@@ -0,0 +1,76 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#include "CXXCFRefTestSupport.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include "cf/CFUniqueRef.hpp"
+
+namespace {
+
+using UniqueData = cf::CFUniqueRef<CFMutableDataRef>;
+
+static_assert(!std::is_copy_constructible_v<UniqueData> && !std::is_copy_assignable_v<UniqueData>);
+static_assert(std::is_nothrow_move_constructible_v<UniqueData> && std::is_nothrow_move_assignable_v<UniqueData>);
+// Ownership moves between the wrappers only explicitly and only from rvalues
+static_assert(std::is_constructible_v<UniqueData, cf::CFMutableData &&>);
+static_assert(!std::is_constructible_v<UniqueData, cf::CFMutableData &>);
+static_assert(!std::is_convertible_v<cf::CFMutableData &&, UniqueData>);
+static_assert(std::is_constructible_v<cf::CFMutableData, UniqueData &&>);
+static_assert(!std::is_constructible_v<cf::CFMutableData, UniqueData &>);
+static_assert(!std::is_convertible_v<UniqueData &&, cf::CFMutableData>);
+static_assert(cf::is_trivially_relocatable_v<UniqueData>);
+
+} /* namespace */
+
+bool cftest::uniqueRefConversion() {
+    auto shared = cf::CFMutableData::adopt(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!shared) {
+        return false;
+    }
+    const auto object = shared.get();
+    const auto observer = cf::CFMutableData::retain(object);
+
+    // Converting from a CFRef takes over its reference
+    UniqueData unique{std::move(shared)};
+    if (shared || unique.get() != object || CFGetRetainCount(object) != 2) {
+        return false;
+    }
+
+    // Moving transfers the reference without retaining
+    auto moved = std::move(unique);
+    UniqueData assigned;
+    assigned = std::move(moved);
+    if (unique || moved || assigned.get() != object || CFGetRetainCount(object) != 2) {
+        return false;
+    }
+
+    // Converting back to a CFRef hands the reference over
+    auto back = static_cast<cf::CFMutableData>(std::move(assigned));
+    if (assigned || back.get() != object || CFGetRetainCount(object) != 2) {
+        return false;
+    }
+    back.reset();
+
+    // A retained CFUniqueRef releases its reference when destroyed
+    {
+        const auto retained = UniqueData::retain(object);
+        if (CFGetRetainCount(object) != 2) {
+            return false;
+        }
+    }
+    if (CFGetRetainCount(object) != 1) {
+        return false;
+    }
+
+    // Immortal objects pass through without reference counting
+    auto boolean = cf::CFUniqueRef<CFBooleanRef>::retain(kCFBooleanTrue);
+    const auto converted = static_cast<cf::CFRef<CFBooleanRef>>(std::move(boolean));
+    return !boolean && converted.get() == kCFBooleanTrue;
+}
@@ -0,0 +1,216 @@
+//
+// SPDX-FileCopyrightText: 2026 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXCFRef
+//
+
+#pragma once
+
+// Checks written in C++ so that they can exercise templates, threads, and Core Foundation callbacks that Swift cannot
+// reach directly. Each check returns true if every expectation held.
+
+namespace cftest {
+
+/// Compares CFRef, CFUniqueRef, RTRef and ImmortalRef instances managing CFTypeRef.
+[[nodiscard]] bool propertyListComparison();
+
+/// Releases many references to an object through a DeferredRelease queue and drains it.
+[[nodiscard]] bool deferredReleaseBalancesRetains();
+
+/// Fills a DeferredRelease queue past its capacity and checks that the excess is released immediately.
+[[nodiscard]] bool deferredReleaseOverflow();
+
+/// Destroys a DeferredRelease queue holding objects and checks that they are released.
+[[nodiscard]] bool deferredReleaseOnDestruction();
+
+/// Copies, assigns and moves RTRefs and checks that every reference is released by the shared queue.
+[[nodiscard]] bool rtRefRetainReleaseBalance();
+
+/// Checks the objects and reference counts produced by AtomicCFRef's exchange operations.
+[[nodiscard]] bool atomicCFRefCompareExchange();
+
+/// Loads from several threads while others store, exchange and compare-exchange, then checks reference counts.
+[[nodiscard]] bool atomicCFRefConcurrentLoadStore();
+
+/// Allocates, reallocates and frees through an arena allocator and checks that objects created from it release it.
+[[nodiscard]] bool arenaAllocator();
+
+/// Checks free list reuse, reallocation and unpooled requests of a pool allocator.
+[[nodiscard]] bool poolAllocator();
+
+/// Allocates and frees blocks of a shared pool allocator from several threads.
+[[nodiscard]] bool poolAllocatorConcurrentUse();
+
+/// Nests ScopedDefaultAllocators and checks that each restores the previous default allocator.
+[[nodiscard]] bool scopedDefaultAllocator();
+
+/// Interns equal, distinct and mutable strings and checks the canonical instances returned.
+[[nodiscard]] bool internTableCanonicalInstances();
+
+/// Checks that only instances referenced solely by an InternTable are evicted, and that clearing releases the rest.
+[[nodiscard]] bool internTableEviction();
+
+/// Interns equal strings from several threads and checks that they agree on each canonical instance.
+[[nodiscard]] bool internTableConcurrentInterning();
+
+/// Checks that heap-stored values in native collections are copied and destroyed exactly once.
+[[nodiscard]] bool nativeCollectionHeapCopies();
+
+/// Stores zero, negative, floating-point and NaN values inline in a native array and reads them back.
+[[nodiscard]] bool nativeCollectionInlineEncoding();
+
+/// Finds dictionary values that are encoded as null and checks that they differ from missing keys.
+[[nodiscard]] bool nativeDictionaryNullEncodedValue();
+
+/// Checks that native binary heaps return values in ascending order.
+[[nodiscard]] bool nativeBinaryHeapOrdering();
+
+/// Checks that number_cast rejects fractional and out-of-range values and accepts exact ones.
+[[nodiscard]] bool numberCastRejectsLossyValues();
+
+/// Checks that cached and created numbers both have the CFNumberType for their C++ type.
+[[nodiscard]] bool makeNumberTypes();
+
+/// Checks that cached integers are returned as the same object for each CFNumberType.
+[[nodiscard]] bool makeNumberCache();
+
+/// Writes a property list to temporary files in the binary and XML formats and reads each back by path.
+[[nodiscard]] bool propertyListFileRoundTrip();
+
+/// Writes a property list to a memory stream and reads it back from a stream.
+[[nodiscard]] bool propertyListStreamRoundTrip();
+
+/// Checks the errors reported for an invalid chunk size and for a pipe whose read end is closed.
+[[nodiscard]] bool propertyListWriteErrors();
+
+/// Reads property lists from missing, invalid and valid files.
+[[nodiscard]] bool readPropertyListFromPath();
+
+/// Iterates an ArrayView forward across chunk boundaries with prefix and postfix increments and copies.
+[[nodiscard]] bool arrayViewForwardIteration();
+
+/// Iterates an ArrayView backward across chunk boundaries.
+[[nodiscard]] bool arrayViewBackwardIteration();
+
+/// Accesses ArrayView elements at random positions across chunk boundaries.
+[[nodiscard]] bool arrayViewRandomAccess();
+
+/// Compares strings, data and numbers for equality, including length mismatches, empty data and numbers of different types.
+[[nodiscard]] bool typedComparatorEquality();
+
+/// Orders strings, data and numbers against CFRefs and raw objects.
+[[nodiscard]] bool typedComparatorOrdering();
+
+/// Copies CFRefs from vectors, arrays and spans with retain_all and releases them in both release modes.
+[[nodiscard]] bool batchRetainAllContainers();
+
+/// Releases CFRefs in vectors, arrays and spans with release_all in both release modes.
+[[nodiscard]] bool batchReleaseAllContainers();
+
+/// Checks retain counts across RefBuffer copies, moves, self-assignment, null elements and destruction.
+[[nodiscard]] bool refBufferRetainCounts();
+
+/// Appends integers at the limits of their types.
+[[nodiscard]] bool stringBuilderIntegers();
+
+/// Appends floating-point values that parse back to the same value.
+[[nodiscard]] bool stringBuilderFloatingPoint();
+
+/// Appends UTF-16 text and CFStrings containing paired and unpaired surrogates.
+[[nodiscard]] bool stringBuilderSurrogates();
+
+/// Appends past the inline capacity of a StringBuilder.
+[[nodiscard]] bool stringBuilderGrowth();
+
+/// Concatenates values of several types with concat.
+[[nodiscard]] bool stringBuilderConcat();
+
+/// Appends format text with escaped braces and substitutes placeholders.
+[[nodiscard]] bool stringBuilderFormatText();
+
+/// Reads UTF-8 contents through the direct, inline copy and heap copy paths, and from a null string.
+[[nodiscard]] bool utf8BufferPaths();
+
+/// Reads UTF-16 contents through the direct, inline copy and heap copy paths, and from a null string.
+[[nodiscard]] bool utf16BufferPaths();
+
+/// Converts file URLs to paths directly, through the long path fallback and against a base URL.
+[[nodiscard]] bool pathRoundTrip();
+
+/// Skips URLs without a file system representation when converting single URLs and arrays.
+[[nodiscard]] bool pathNonFileURLs();
+
+/// Creates arrays of file URLs from ranges of paths and converts them back.
+[[nodiscard]] bool pathBatchForms();
+
+/// Copies, moves and leaks CFRefs to CFBoolean and CFNull values and checks that their retain counts are unchanged.
+[[nodiscard]] bool immortalTypesSkipRetainCounts();
+
+/// Completes reads and writes on a bound pair before returning when bytes or space are available.
+[[nodiscard]] bool streamImmediateCompletion();
+
+/// Completes reads and writes on a bound pair from the run loop once bytes or space become available.
+[[nodiscard]] bool streamAsynchronousCompletion();
+
+/// Reads from a bound pair whose writer is closed and writes to the closed writer.
+[[nodiscard]] bool streamEndOfStream();
+
+/// Reads and writes streams that are not open and writes to a bound pair whose reader is closed.
+[[nodiscard]] bool streamErrors();
+
+/// Reads from a memory stream's internal buffer and from a bound pair.
+[[nodiscard]] bool streamBufferedRead();
+
+/// Transfers the storage of vectors to CFData objects and checks that each is freed exactly once.
+[[nodiscard]] bool dataFromVectorFreesOnce();
+
+/// Maps empty, missing and directory paths and checks the results and errors.
+[[nodiscard]] bool mappedDataEmptyAndMissingFiles();
+
+/// Modifies a copy-on-write mapping and checks that the file and other mappings are unchanged.
+[[nodiscard]] bool mappedDataCopyOnWrite();
+
+/// Checks isa and dyn_cast against matching, mismatched, mutable and null objects.
+[[nodiscard]] bool castTypeChecks();
+
+/// Checks the references held by CFRefs returned by cast from raw objects, CFRefs and rvalue CFRefs.
+[[nodiscard]] bool castOwnership();
+
+/// Builds arrays and sets from ranges and initializer lists, including equal set elements.
+[[nodiscard]] bool makeArrayAndSet();
+
+/// Builds dictionaries from sized and single-pass ranges and checks that the first pair for a duplicated key is kept.
+[[nodiscard]] bool makeDictionaryPairs();
+
+/// Converts ranges of UTF-8 strings to CFArrays and back.
+[[nodiscard]] bool toCFArrayRoundTrip();
+
+/// Converts ranges containing strings that are not valid UTF-8 and checks that each conversion fails.
+[[nodiscard]] bool toCFArrayInvalidElement();
+
+/// Transforms the elements of arrays concurrently and checks the order of the results.
+[[nodiscard]] bool parallelTransformResults();
+
+/// Transforms arrays with a function that returns null or throws and checks that every result is released.
+[[nodiscard]] bool parallelTransformFailures();
+
+/// Converts between CFRef and CFUniqueRef and checks that references are transferred without retaining.
+[[nodiscard]] bool uniqueRefConversion();
+
+/// Relocates CFRefs and checks that no reference is retained or released.
+[[nodiscard]] bool relocateTriviallyRelocatable();
+
+/// Relocates a type that is not trivially relocatable and checks that each object is moved and destroyed.
+[[nodiscard]] bool relocateMoveConstructible();
+
+/// Iterates a DictionaryView larger than its inline storage and checks its pairs.
+[[nodiscard]] bool dictionaryViewPairs();
+
+/// Looks up keys through a DictionaryView and checks that nothing is retained.
+[[nodiscard]] bool dictionaryViewLookup();
+
+/// Performs each kind of reference operation and checks the counts recorded for it.
+[[nodiscard]] bool instrumentationCounters();
+
+} /* namespace cftest */
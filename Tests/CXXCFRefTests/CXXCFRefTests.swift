@@ -5,11 +5,171 @@
 // Part of https://github.com/sbooth/CXXCFRef
 //
 
+import Foundation
 import Testing
 @testable import CXXCFRef
+import CXXCFRefTestSupport
 
 @Test func basic() async throws {
     var s = cf.CFString()
     #expect(s.__convertToBool() == false)
     s.reset()
 }
+
+@Test func propertyListComparison() async throws {
+    #expect(cftest.propertyListComparison())
+}
+
+@Test func deferredRelease() async throws {
+    #expect(cftest.deferredReleaseBalancesRetains())
+    #expect(cftest.deferredReleaseOverflow())
+    #expect(cftest.deferredReleaseOnDestruction())
+}
+
+@Test func rtRef() async throws {
+    #expect(cftest.rtRefRetainReleaseBalance())
+}
+
+@Test func atomicCFRef() async throws {
+    #expect(cftest.atomicCFRefCompareExchange())
+    #expect(cftest.atomicCFRefConcurrentLoadStore())
+}
+
+@Test func allocators() async throws {
+    #expect(cftest.arenaAllocator())
+    #expect(cftest.poolAllocator())
+    #expect(cftest.poolAllocatorConcurrentUse())
+    #expect(cftest.scopedDefaultAllocator())
+}
+
+@Test func internTable() async throws {
+    #expect(cftest.internTableCanonicalInstances())
+    #expect(cftest.internTableEviction())
+    #expect(cftest.internTableConcurrentInterning())
+}
+
+@Test func nativeCollections() async throws {
+    #expect(cftest.nativeCollectionHeapCopies())
+    #expect(cftest.nativeCollectionInlineEncoding())
+    #expect(cftest.nativeDictionaryNullEncodedValue())
+    #expect(cftest.nativeBinaryHeapOrdering())
+}
+
+@Test func numbers() async throws {
+    #expect(cftest.numberCastRejectsLossyValues())
+    #expect(cftest.makeNumberTypes())
+    #expect(cftest.makeNumberCache())
+}
+
+@Test func propertyLists() async throws {
+    #expect(cftest.propertyListFileRoundTrip())
+    #expect(cftest.propertyListStreamRoundTrip())
+    #expect(cftest.propertyListWriteErrors())
+    #expect(cftest.readPropertyListFromPath())
+}
+
+@Test func arrayViews() async throws {
+    #expect(cftest.arrayViewForwardIteration())
+    #expect(cftest.arrayViewBackwardIteration())
+    #expect(cftest.arrayViewRandomAccess())
+}
+
+@Test func typedComparators() async throws {
+    #expect(cftest.typedComparatorEquality())
+    #expect(cftest.typedComparatorOrdering())
+}
+
+@Test func batches() async throws {
+    #expect(cftest.batchRetainAllContainers())
+    #expect(cftest.batchReleaseAllContainers())
+    #expect(cftest.refBufferRetainCounts())
+}
+
+@Test func stringBuilders() async throws {
+    #expect(cftest.stringBuilderIntegers())
+    #expect(cftest.stringBuilderFloatingPoint())
+    #expect(cftest.stringBuilderSurrogates())
+    #expect(cftest.stringBuilderGrowth())
+    #expect(cftest.stringBuilderConcat())
+    #expect(cftest.stringBuilderFormatText())
+}
+
+@Test func stringViews() async throws {
+    #expect(cftest.utf8BufferPaths())
+    #expect(cftest.utf16BufferPaths())
+}
+
+@Test func paths() async throws {
+    #expect(cftest.pathRoundTrip())
+    #expect(cftest.pathNonFileURLs())
+    #expect(cftest.pathBatchForms())
+}
+
+@Test func immortalTypes() async throws {
+    #expect(cftest.immortalTypesSkipRetainCounts())
+}
+
+@Test func streams() async throws {
+    #expect(cftest.streamImmediateCompletion())
+    #expect(cftest.streamAsynchronousCompletion())
+    #expect(cftest.streamEndOfStream())
+    #expect(cftest.streamErrors())
+    #expect(cftest.streamBufferedRead())
+}
+
+@Test func data() async throws {
+    #expect(cftest.dataFromVectorFreesOnce())
+}
+
+@Test func mappedData() async throws {
+    #expect(cftest.mappedDataEmptyAndMissingFiles())
+    #expect(cftest.mappedDataCopyOnWrite())
+}
+
+@Test func casts() async throws {
+    #expect(cftest.castTypeChecks())
+    #expect(cftest.castOwnership())
+}
+
+@Test func builders() async throws {
+    #expect(cftest.makeArrayAndSet())
+    #expect(cftest.makeDictionaryPairs())
+}
+
+@Test func strings() async throws {
+    #expect(cftest.toCFArrayRoundTrip())
+    #expect(cftest.toCFArrayInvalidElement())
+}
+
+@Test func parallel() async throws {
+    #expect(cftest.parallelTransformResults())
+    #expect(cftest.parallelTransformFailures())
+}
+
+@Test func uniqueRefs() async throws {
+    #expect(cftest.uniqueRefConversion())
+}
+
+@Test func relocation() async throws {
+    #expect(cftest.relocateTriviallyRelocatable())
+    #expect(cftest.relocateMoveConstructible())
+}
+
+@Test func dictionaryView() async throws {
+    #expect(cftest.dictionaryViewPairs())
+    #expect(cftest.dictionaryViewLookup())
+}
+
+@Test func instrumentationCounters() async throws {
+    #expect(cftest.instrumentationCounters())
+}
+
+#if compiler(>=6.1)
+@Test func borrowedObject() async throws {
+    let string = "borrowed" as CFString
+    let s = cf.CFString.retain(string)
+    #expect(s.object === string)
+    let u = cf.CFUniqueString.retain(string)
+    #expect(u.object === string)
+}
+#endif